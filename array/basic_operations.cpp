@@ -1,159 +1,608 @@
 #include <iostream>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <chrono>
+#include <random>
 using namespace std;
 
+// ========================================
+// DYNAMIC ARRAY (GROWABLE, TEMPLATED)
+// ========================================
+// Concept: Contiguous array that owns its capacity
+// - Capacity doubles when full (amortized O(1) push_back)
+// - Inserts / erases shift the tail once per call; trivially copyable
+//   types shift with a single memmove instead of element by element
+// - insert_range / erase_range open or close a whole hole in one shift
+// - Alloc is any standard allocator (see CountingAllocator below)
+// - Gap-buffer mode: the unused capacity is kept as a "gap" at the last
+//   edit position, so a run of edits near a moving cursor costs
+//   O(distance moved) instead of O(elements after the cursor)
+// Storage layout: [0, gapStart) elements | gap | [gapEnd, cap) elements.
+// In normal mode the gap is always at the end (gapEnd == cap), so the
+// elements are contiguous and data() is a plain pointer.
+template <typename T, typename Alloc = allocator<T>>
+class DynArray {
+private:
+    using Traits = allocator_traits<Alloc>;
+
+    Alloc alloc;
+    T* buf;
+    size_t cap;
+    size_t gapStart;
+    size_t gapEnd;
+    bool gapMode;
+
+    size_t gapLen() const { return gapEnd - gapStart; }
+    size_t tailLen() const { return cap - gapEnd; }
+
+    // Move n elements from src to uninitialized dst, destroying the
+    // sources. The ranges may overlap.
+    static void relocate(T* dst, T* src, size_t n) {
+        if (n == 0 || dst == src) return;
+        if constexpr (is_trivially_copyable<T>::value) {
+            memmove(static_cast<void*>(dst), src, n * sizeof(T));
+        } else if (dst < src) {
+            for (size_t i = 0; i < n; i++) {
+                new (dst + i) T(std::move(src[i]));
+                src[i].~T();
+            }
+        } else {
+            for (size_t i = n; i > 0; i--) {
+                new (dst + i - 1) T(std::move(src[i - 1]));
+                src[i - 1].~T();
+            }
+        }
+    }
+
+    void grow(size_t minCap) {
+        size_t newCap = cap * 2;
+        if (newCap < 16) newCap = 16;
+        if (newCap < minCap) newCap = minCap;
+
+        T* newBuf = Traits::allocate(alloc, newCap);
+        size_t tail = tailLen();
+        relocate(newBuf, buf, gapStart);
+        relocate(newBuf + newCap - tail, buf + gapEnd, tail);
+        if (buf) Traits::deallocate(alloc, buf, cap);
+        buf = newBuf;
+        gapEnd = newCap - tail;
+        cap = newCap;
+    }
+
+    // Put the gap at logical position pos
+    void moveGap(size_t pos) {
+        if (pos < gapStart) {
+            size_t n = gapStart - pos;
+            relocate(buf + gapEnd - n, buf + pos, n);
+            gapStart -= n;
+            gapEnd -= n;
+        } else if (pos > gapStart) {
+            size_t n = pos - gapStart;
+            relocate(buf + gapStart, buf + gapEnd, n);
+            gapStart += n;
+            gapEnd += n;
+        }
+    }
+
+    // Make count uninitialized slots at logical position pos and return
+    // the first one. The caller constructs them, then bumps gapStart.
+    T* openHole(size_t pos, size_t count) {
+        if (gapLen() < count) grow(size() + count);
+        if (gapMode) {
+            moveGap(pos);
+        } else {
+            // Gap is at the end: shift the tail right by count, once
+            relocate(buf + pos + count, buf + pos, gapStart - pos);
+        }
+        return buf + pos;
+    }
+
+    // Undo openHole(pos, count) when constructing into the hole threw
+    void closeHole(size_t pos, size_t count) {
+        if (!gapMode) relocate(buf + pos, buf + pos + count, gapStart - pos);
+    }
+
+    // True if p points into this array's storage
+    bool ownsPointer(const T* p) const {
+        return buf && !less<const T*>()(p, buf) && less<const T*>()(p, buf + cap);
+    }
+
+    void destroyAll() {
+        if constexpr (!is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < gapStart; i++) buf[i].~T();
+            for (size_t i = gapEnd; i < cap; i++) buf[i].~T();
+        }
+    }
+
+    void release() {
+        destroyAll();
+        if (buf) Traits::deallocate(alloc, buf, cap);
+        buf = nullptr;
+        cap = gapStart = gapEnd = 0;
+    }
+
+public:
+    explicit DynArray(const Alloc& a = Alloc())
+        : alloc(a), buf(nullptr), cap(0), gapStart(0), gapEnd(0), gapMode(false) {}
+
+    DynArray(initializer_list<T> values, const Alloc& a = Alloc()) : DynArray(a) {
+        insert_range(0, values.begin(), values.end());
+    }
+
+    DynArray(const DynArray& other)
+        : DynArray(Traits::select_on_container_copy_construction(other.alloc)) {
+        reserve(other.size());
+        for (size_t i = 0; i < other.size(); i++) push_back(other[i]);
+    }
+
+    DynArray(DynArray&& other) noexcept
+        : alloc(std::move(other.alloc)), buf(other.buf), cap(other.cap),
+          gapStart(other.gapStart), gapEnd(other.gapEnd), gapMode(other.gapMode) {
+        other.buf = nullptr;
+        other.cap = other.gapStart = other.gapEnd = 0;
+    }
+
+    DynArray& operator=(const DynArray& other) {
+        if (this != &other) {
+            DynArray copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    DynArray& operator=(DynArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~DynArray() { release(); }
+
+    void swap(DynArray& other) noexcept {
+        std::swap(alloc, other.alloc);
+        std::swap(buf, other.buf);
+        std::swap(cap, other.cap);
+        std::swap(gapStart, other.gapStart);
+        std::swap(gapEnd, other.gapEnd);
+        std::swap(gapMode, other.gapMode);
+    }
+
+    bool isEmpty() const { return size() == 0; }
+    size_t size() const { return cap - gapLen(); }
+    size_t capacity() const { return cap; }
+    const Alloc& get_allocator() const { return alloc; }
+
+    // Ensure room for at least n elements without further allocation
+    void reserve(size_t n) {
+        if (n > cap) grow(n);
+    }
+
+    // Gap-buffer mode on/off; turning it off closes the gap (O(tail))
+    void setGapMode(bool on) {
+        if (!on) moveGap(size());
+        gapMode = on;
+    }
+    bool inGapMode() const { return gapMode; }
+
+    // Logical element i
+    T& operator[](size_t i) { return buf[i < gapStart ? i : i + gapLen()]; }
+    const T& operator[](size_t i) const { return buf[i < gapStart ? i : i + gapLen()]; }
+
+    T& at(size_t i) {
+        if (i >= size()) throw out_of_range("DynArray::at");
+        return (*this)[i];
+    }
+
+    // Precondition: !isEmpty()
+    T& front() { return (*this)[0]; }
+    T& back() { return (*this)[size() - 1]; }
+
+    // Contiguous view; in gap mode this first closes the gap
+    T* data() {
+        moveGap(size());
+        return buf;
+    }
+    T* begin() { return data(); }
+    T* end() { return data() + size(); }
+
+    void push_back(const T& value) { emplace(size(), value); }
+    void push_back(T&& value) { emplace(size(), std::move(value)); }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        return emplace(size(), std::forward<Args>(args)...);
+    }
+
+    // Precondition: !isEmpty()
+    void pop_back() { erase(size() - 1); }
+
+    // The value is built before the hole is opened, so args may refer to
+    // elements of this array (e.g. arr.insert(0, arr[3]))
+    template <typename... Args>
+    T& emplace(size_t pos, Args&&... args) {
+        T value(std::forward<Args>(args)...);
+        T* slot = openHole(pos, 1);
+        try {
+            new (slot) T(std::move(value));
+        } catch (...) {
+            closeHole(pos, 1);
+            throw;
+        }
+        gapStart++;
+        return *slot;
+    }
+
+    void insert(size_t pos, const T& value) { emplace(pos, value); }
+    void insert(size_t pos, T&& value) { emplace(pos, std::move(value)); }
+
+    // Insert [first, last) before logical position pos with one shift.
+    // Opening the hole may shift or reallocate the storage, so a range
+    // taken from this array (e.g. arr.insert_range(2, arr.data(), arr.data() + 4))
+    // is copied out first, as emplace builds its value first.
+    template <typename It>
+    void insert_range(size_t pos, It first, It last) {
+        constexpr bool elementPointer =
+            is_pointer<It>::value &&
+            is_same<typename remove_cv<typename remove_pointer<It>::type>::type, T>::value;
+        size_t count = (size_t)distance(first, last);
+        if (count == 0) return;
+        if constexpr (elementPointer) {
+            if (ownsPointer(first)) {
+                DynArray copy(alloc);
+                copy.insert_range(0, first, last);
+                insert_range(pos, make_move_iterator(copy.buf), make_move_iterator(copy.buf + count));
+                return;
+            }
+        }
+        T* hole = openHole(pos, count);
+        if constexpr (is_trivially_copyable<T>::value && elementPointer) {
+            memcpy(static_cast<void*>(hole), first, count * sizeof(T));
+        } else {
+            try {
+                uninitialized_copy(first, last, hole);
+            } catch (...) {
+                closeHole(pos, count);
+                throw;
+            }
+        }
+        gapStart += count;
+    }
+
+    void insert_range(size_t pos, const T* src, size_t count) {
+        insert_range(pos, src, src + count);
+    }
+
+    // Remove logical positions [first, last) with one shift
+    void erase_range(size_t first, size_t last) {
+        if (first >= last) return;
+        size_t count = last - first;
+        if (gapMode) {
+            moveGap(first);
+            if constexpr (!is_trivially_destructible<T>::value) {
+                for (size_t i = 0; i < count; i++) buf[gapEnd + i].~T();
+            }
+            gapEnd += count;
+        } else {
+            if constexpr (!is_trivially_destructible<T>::value) {
+                for (size_t i = first; i < last; i++) buf[i].~T();
+            }
+            relocate(buf + first, buf + last, gapStart - last);
+            gapStart -= count;
+        }
+    }
+
+    void erase(size_t pos) { erase_range(pos, pos + 1); }
+
+    void clear() {
+        destroyAll();
+        gapStart = 0;
+        gapEnd = cap;
+    }
+};
+
+// ========================================
+// COUNTING ALLOCATOR (example pluggable allocator)
+// ========================================
+// Usage: DynArray<int, CountingAllocator<int>> arr; then CountingStats::allocations
+struct CountingStats {
+    inline static size_t allocations = 0;
+    inline static size_t bytes = 0;
+};
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        CountingStats::allocations++;
+        CountingStats::bytes += n * sizeof(T);
+        return allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n) { allocator<T>().deallocate(p, n); }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+// ========================================
+// ARRAY OPERATIONS USING DYNAMIC ARRAY
+// ========================================
+// Same operations as before, but the array grows instead of reporting
+// "Array is full", and each insert / delete shifts the tail in one call.
+
 // Function to display the array
-// Usage: display(arr, n) - displays all n elements
-void display(int arr[], int n) {
-    if (n == 0) {
+// Usage: display(arr) - displays all elements
+void display(const DynArray<int>& arr) {
+    if (arr.isEmpty()) {
         cout << "Array is empty." << endl;
         return;
     }
     cout << "Array elements: ";
-    for (int i = 0; i < n; i++) {
+    for (size_t i = 0; i < arr.size(); i++) {
         cout << arr[i] << " ";
     }
     cout << endl;
 }
 
 // Function to insert at start
-// Usage: newSize = insertAtStart(arr, n, capacity, value)
-// Example: newSize = insertAtStart(arr, 5, 10, 99) - inserts 99 at start
-int insertAtStart(int arr[], int n, int capacity, int val) {
-    if (n == capacity) {
-        cout << "Array is full. Cannot insert." << endl;
-        return n;
-    }
-    for (int i = n; i > 0; i--) {
-        arr[i] = arr[i - 1];
-    }
-    arr[0] = val;
+// Usage: insertAtStart(arr, value)
+// Example: insertAtStart(arr, 99) - inserts 99 at start
+void insertAtStart(DynArray<int>& arr, int val) {
+    arr.insert(0, val);
     cout << "Inserted " << val << " at start." << endl;
-    return n + 1;
 }
 
 // Function to insert at end
-// Usage: newSize = insertAtEnd(arr, n, capacity, value)
-// Example: newSize = insertAtEnd(arr, 5, 10, 99) - inserts 99 at end
-int insertAtEnd(int arr[], int n, int capacity, int val) {
-    if (n == capacity) {
-        cout << "Array is full. Cannot insert." << endl;
-        return n;
-    }
-    arr[n] = val;
+// Usage: insertAtEnd(arr, value)
+// Example: insertAtEnd(arr, 99) - inserts 99 at end
+void insertAtEnd(DynArray<int>& arr, int val) {
+    arr.push_back(val);
     cout << "Inserted " << val << " at end." << endl;
-    return n + 1;
 }
 
 // Function to insert at specific index
-// Usage: newSize = insertAtIndex(arr, n, capacity, index, value)
-// Example: newSize = insertAtIndex(arr, 5, 10, 2, 99) - inserts 99 at index 2
-int insertAtIndex(int arr[], int n, int capacity, int index, int val) {
-    if (n == capacity) {
-        cout << "Array is full. Cannot insert." << endl;
-        return n;
-    }
-    if (index < 0 || index > n) {
+// Usage: insertAtIndex(arr, index, value)
+// Example: insertAtIndex(arr, 2, 99) - inserts 99 at index 2
+void insertAtIndex(DynArray<int>& arr, int index, int val) {
+    if (index < 0 || (size_t)index > arr.size()) {
         cout << "Invalid index." << endl;
-        return n;
-    }
-    for (int i = n; i > index; i--) {
-        arr[i] = arr[i - 1];
+        return;
     }
-    arr[index] = val;
+    arr.insert(index, val);
     cout << "Inserted " << val << " at index " << index << "." << endl;
-    return n + 1;
 }
 
 // Function to delete at specific index
-// Usage: newSize = deleteAtIndex(arr, n, index)
-// Example: newSize = deleteAtIndex(arr, 5, 2) - deletes element at index 2
-int deleteAtIndex(int arr[], int n, int index) {
-    if (n == 0) {
+// Usage: deleteAtIndex(arr, index)
+// Example: deleteAtIndex(arr, 2) - deletes element at index 2
+void deleteAtIndex(DynArray<int>& arr, int index) {
+    if (arr.isEmpty()) {
         cout << "Array is empty. Cannot delete." << endl;
-        return n;
+        return;
     }
-    if (index < 0 || index >= n) {
+    if (index < 0 || (size_t)index >= arr.size()) {
         cout << "Invalid index." << endl;
-        return n;
+        return;
     }
     int deletedVal = arr[index];
-    for (int i = index; i < n - 1; i++) {
-        arr[i] = arr[i + 1];
-    }
+    arr.erase(index);
     cout << "Deleted " << deletedVal << " from index " << index << "." << endl;
-    return n - 1;
 }
 
 // Function to delete by value (first occurrence)
-// Usage: newSize = deleteValue(arr, n, value)
-// Example: newSize = deleteValue(arr, 5, 30) - deletes first occurrence of 30
-int deleteValue(int arr[], int n, int val) {
-    if (n == 0) {
+// Usage: deleteValue(arr, value)
+// Example: deleteValue(arr, 30) - deletes first occurrence of 30
+void deleteValue(DynArray<int>& arr, int val) {
+    if (arr.isEmpty()) {
         cout << "Array is empty. Cannot delete." << endl;
-        return n;
+        return;
     }
     int index = -1;
-    for (int i = 0; i < n; i++) {
+    for (size_t i = 0; i < arr.size(); i++) {
         if (arr[i] == val) {
-            index = i;
+            index = (int)i;
             break;
         }
     }
     if (index == -1) {
         cout << "Value " << val << " not found." << endl;
-        return n;
+        return;
+    }
+    deleteAtIndex(arr, index);
+}
+
+// ========================================
+// BENCHMARK: DynArray<int> vs std::vector<int>
+// ========================================
+// Usage: benchmarkDynArray(n)
+// Example: benchmarkDynArray(100000) - n inserts per pattern
+// Patterns: insert at front, insert in the middle, edits at a cursor that
+// drifts a few positions per edit, and one bulk insert_range per 64 values
+void benchmarkDynArray(int n) {
+    using Clock = chrono::steady_clock;
+    long long checksum = 0;
+    auto report = [&](const char* name, Clock::time_point start) {
+        double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+        cout << name << ": " << ms << " ms" << endl;
+    };
+
+    {
+        vector<int> v;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) v.insert(v.begin(), i);
+        report("front insert   std::vector      ", start);
+        checksum += v[n / 2];
     }
-    return deleteAtIndex(arr, n, index);
+    {
+        DynArray<int> a;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) a.insert(0, i);
+        report("front insert   DynArray         ", start);
+        checksum += a[n / 2];
+    }
+    {
+        DynArray<int> a;
+        a.setGapMode(true);
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) a.insert(0, i);
+        report("front insert   DynArray (gap)   ", start);
+        checksum += a[n / 2];
+    }
+
+    {
+        vector<int> v;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) v.insert(v.begin() + v.size() / 2, i);
+        report("middle insert  std::vector      ", start);
+        checksum += v[n / 3];
+    }
+    {
+        DynArray<int> a;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) a.insert(a.size() / 2, i);
+        report("middle insert  DynArray         ", start);
+        checksum += a[n / 3];
+    }
+    {
+        DynArray<int> a;
+        a.setGapMode(true);
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) a.insert(a.size() / 2, i);
+        report("middle insert  DynArray (gap)   ", start);
+        checksum += a[n / 3];
+    }
+
+    // Text-editor style: cursor moves by -4..+4 between edits, 1 in 4 edits deletes
+    vector<int> steps(n);
+    mt19937 rng(5);
+    for (auto& s : steps) s = (int)(rng() % 9) - 4;
+    {
+        vector<int> v(n, 0);
+        size_t cursor = n / 2;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) {
+            cursor = min(v.size(), (size_t)max<long long>(0, (long long)cursor + steps[i]));
+            if ((i & 3) == 3 && cursor < v.size()) v.erase(v.begin() + cursor);
+            else v.insert(v.begin() + cursor, i);
+        }
+        report("cursor edits   std::vector      ", start);
+        checksum += v.size();
+    }
+    {
+        DynArray<int> a;
+        for (int i = 0; i < n; i++) a.push_back(0);
+        a.setGapMode(true);
+        size_t cursor = n / 2;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i++) {
+            cursor = min(a.size(), (size_t)max<long long>(0, (long long)cursor + steps[i]));
+            if ((i & 3) == 3 && cursor < a.size()) a.erase(cursor);
+            else a.insert(cursor, i);
+        }
+        report("cursor edits   DynArray (gap)   ", start);
+        checksum += a.size();
+    }
+
+    int block[64];
+    for (int j = 0; j < 64; j++) block[j] = j;
+    {
+        vector<int> v;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i += 64) v.insert(v.begin() + v.size() / 2, block, block + 64);
+        report("bulk middle    std::vector      ", start);
+        checksum += v.size();
+    }
+    {
+        DynArray<int, CountingAllocator<int>> a;
+        CountingStats::allocations = 0;
+        auto start = Clock::now();
+        for (int i = 0; i < n; i += 64) a.insert_range(a.size() / 2, block, 64);
+        report("bulk middle    DynArray         ", start);
+        cout << "  (allocations: " << CountingStats::allocations << ")" << endl;
+        checksum += a.size();
+    }
+
+    cout << "(checksum " << checksum << ")" << endl;
 }
 
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
 int main() {
-    int n, capacity;
-    
-    cout << "Enter array capacity: ";
-    cin >> capacity;
-    
-    int* arr = new int[capacity];
-    
+    int n;
+    DynArray<int> arr;
+
     cout << "Enter number of elements: ";
     cin >> n;
-    
-    if (n > capacity) {
-        cout << "Size exceeds capacity. Setting size to capacity." << endl;
-        n = capacity;
-    }
-    
+
     cout << "Enter " << n << " elements: ";
     for (int i = 0; i < n; i++) {
-        cin >> arr[i];
+        int value;
+        cin >> value;
+        arr.push_back(value);
     }
-    
+
     cout << "\n=== Initial Array ===" << endl;
-    display(arr, n);
-    
+    display(arr);
+
     // ========================================
     // Example function calls - uncomment to use
     // ========================================
-    
+
     // Insert at start
-    // n = insertAtStart(arr, n, capacity, 5);
-    // display(arr, n);
-    
+    // insertAtStart(arr, 5);
+    // display(arr);
+
     // Insert at end
-    // n = insertAtEnd(arr, n, capacity, 60);
-    // display(arr, n);
-    
+    // insertAtEnd(arr, 60);
+    // display(arr);
+
     // Insert at index 2
-    // n = insertAtIndex(arr, n, capacity, 2, 25);
-    // display(arr, n);
-    
+    // insertAtIndex(arr, 2, 25);
+    // display(arr);
+
     // Delete at index 1
-    // n = deleteAtIndex(arr, n, 1);
-    // display(arr, n);
-    
+    // deleteAtIndex(arr, 1);
+    // display(arr);
+
     // Delete value 30
-    // n = deleteValue(arr, n, 30);
-    // display(arr, n);
-    
-    delete[] arr;
+    // deleteValue(arr, 30);
+    // display(arr);
+
+    // Bulk insert / erase
+    // int block[] = {7, 8, 9};
+    // arr.insert_range(1, block, 3);
+    // arr.erase_range(0, 2);
+    // display(arr);
+
+    // A range of the array itself may be inserted (copied out first)
+    // arr.insert_range(2, arr.data(), arr.data() + 4);
+    // display(arr);
+
+    // Gap-buffer mode for many edits around a cursor
+    // arr.setGapMode(true);
+    // arr.insert(1, 42);
+    // arr.insert(2, 43);
+    // arr.setGapMode(false);
+    // display(arr);
+
+    // Benchmark against std::vector
+    // benchmarkDynArray(100000);
+
     return 0;
 }
@@ -0,0 +1,544 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE2__)
+#define COMPRESSED_SSE2 1
+#include <emmintrin.h>
+#else
+#define COMPRESSED_SSE2 0
+#endif
+using namespace std;
+
+// ========================================
+// COMPRESSED SORTED INT ARRAY
+// ========================================
+// Concept: A sorted ID list has small gaps, so storing the gaps instead of
+// the values needs far fewer bits. The list is cut into blocks of 128:
+// - Delta: inside a block, value i is stored as value[i] - value[i - 4]
+//   (the first four relative to the block's first value). Four interleaved
+//   delta chains decode with one 4-wide vector add per 4 values.
+// - Bit-packing: each block stores its deltas with the smallest width b
+//   that minimizes size, 4 lanes side by side (lane l holds deltas l,
+//   l + 4, ...), so one shift + mask unpacks 4 values (SSE2).
+// - PFor exceptions: deltas wider than b store only their low b bits in
+//   the packed area; the high bits and position are stored after it, so a
+//   few large gaps do not widen the whole block.
+// - Skip pointers: the first and last value and data offset of every
+//   block, so search / intersection decode only the blocks they need.
+// Works for any sorted (non-decreasing) ints, negative values included.
+
+const size_t CBLOCK = 128;
+
+inline int bitWidth(uint32_t x) { return x ? 32 - __builtin_clz(x) : 0; }
+
+// ========================================
+// 1. BLOCK PACK / UNPACK
+// ========================================
+// Layout of B-bit deltas: lane l's 32 values form a bit stream stored in
+// 32-bit words data[4w + l], so word w of all four lanes is one vector.
+
+void packBlock(const uint32_t* deltas, int B, uint32_t* out) {
+    memset(out, 0, 4 * B * sizeof(uint32_t));
+    if (B == 0) return;
+    uint32_t mask = B == 32 ? 0xFFFFFFFFu : (1u << B) - 1;
+    for (size_t l = 0; l < 4; l++) {
+        for (size_t j = 0; j < 32; j++) {
+            uint32_t v = deltas[4 * j + l] & mask;
+            size_t bit = j * B, w = bit / 32, s = bit % 32;
+            out[4 * w + l] |= v << s;
+            if (s + B > 32) out[4 * (w + 1) + l] |= v >> (32 - s);
+        }
+    }
+}
+
+#if COMPRESSED_SSE2
+template <int B>
+void unpackBlock(const uint32_t* in, uint32_t* out) {
+    const __m128i* src = (const __m128i*)in;
+    __m128i* dst = (__m128i*)out;
+    if constexpr (B == 0) {
+        for (int k = 0; k < 32; k++) _mm_storeu_si128(dst + k, _mm_setzero_si128());
+    } else {
+        const __m128i mask = _mm_set1_epi32(B == 32 ? -1 : (int)((1u << B) - 1));
+#pragma GCC unroll 32
+        for (int k = 0; k < 32; k++) {
+            const int bit = k * B, word = bit / 32, shift = bit % 32;
+            __m128i v = _mm_srli_epi32(_mm_loadu_si128(src + word), shift);
+            if (shift + B > 32) v = _mm_or_si128(v, _mm_slli_epi32(_mm_loadu_si128(src + word + 1), 32 - shift));
+            _mm_storeu_si128(dst + k, _mm_and_si128(v, mask));
+        }
+    }
+}
+
+// Blocks without exceptions: unpack and prefix-sum in registers
+template <int B>
+void decodePacked(const uint32_t* in, int base, int* out) {
+    const __m128i* src = (const __m128i*)in;
+    __m128i* dst = (__m128i*)out;
+    __m128i prev = _mm_set1_epi32(base);
+    if constexpr (B == 0) {
+        for (int k = 0; k < 32; k++) _mm_storeu_si128(dst + k, prev);
+    } else {
+        const __m128i mask = _mm_set1_epi32(B == 32 ? -1 : (int)((1u << B) - 1));
+#pragma GCC unroll 32
+        for (int k = 0; k < 32; k++) {
+            const int bit = k * B, word = bit / 32, shift = bit % 32;
+            __m128i v = _mm_srli_epi32(_mm_loadu_si128(src + word), shift);
+            if (shift + B > 32) v = _mm_or_si128(v, _mm_slli_epi32(_mm_loadu_si128(src + word + 1), 32 - shift));
+            prev = _mm_add_epi32(prev, _mm_and_si128(v, mask));
+            _mm_storeu_si128(dst + k, prev);
+        }
+    }
+}
+
+// out[i] = base + sum of the deltas in i's lane up to i
+void prefixSumLanes(const uint32_t* deltas, int base, int* out) {
+    __m128i prev = _mm_set1_epi32(base);
+    for (int k = 0; k < 32; k++) {
+        prev = _mm_add_epi32(prev, _mm_loadu_si128((const __m128i*)deltas + k));
+        _mm_storeu_si128((__m128i*)out + k, prev);
+    }
+}
+#else
+template <int B>
+void unpackBlock(const uint32_t* in, uint32_t* out) {
+    uint32_t mask = B == 32 ? 0xFFFFFFFFu : (uint32_t)((1ull << B) - 1);
+    for (int l = 0; l < 4; l++) {
+        for (int j = 0; j < 32; j++) {
+            if (B == 0) {
+                out[4 * j + l] = 0;
+                continue;
+            }
+            int bit = j * B, w = bit / 32, s = bit % 32;
+            uint64_t v = in[4 * w + l] >> s;
+            if (s + B > 32) v |= (uint64_t)in[4 * (w + 1) + l] << (32 - s);
+            out[4 * j + l] = (uint32_t)v & mask;
+        }
+    }
+}
+
+void prefixSumLanes(const uint32_t* deltas, int base, int* out);
+
+template <int B>
+void decodePacked(const uint32_t* in, int base, int* out) {
+    uint32_t deltas[128];
+    unpackBlock<B>(in, deltas);
+    prefixSumLanes(deltas, base, out);
+}
+
+void prefixSumLanes(const uint32_t* deltas, int base, int* out) {
+    uint32_t prev[4] = {(uint32_t)base, (uint32_t)base, (uint32_t)base, (uint32_t)base};
+    for (int i = 0; i < 128; i++) {
+        prev[i % 4] += deltas[i];
+        out[i] = (int)prev[i % 4];
+    }
+}
+#endif
+
+// One unpacker / decoder per width, so the shift counts are compile-time
+// constants; fns[B] handles B-bit deltas, B = 0..32
+typedef void (*UnpackFn)(const uint32_t*, uint32_t*);
+typedef void (*DecodeFn)(const uint32_t*, int, int*);
+
+template <int... Bs>
+struct BlockCodecTable {
+    static constexpr UnpackFn unpack[sizeof...(Bs)] = {&unpackBlock<Bs>...};
+    static constexpr DecodeFn decode[sizeof...(Bs)] = {&decodePacked<Bs>...};
+};
+
+template <size_t... Is>
+constexpr BlockCodecTable<(int)Is...> makeCodecTable(index_sequence<Is...>) {
+    return {};
+}
+
+typedef decltype(makeCodecTable(make_index_sequence<33>())) BlockCodec;
+
+// ========================================
+// 2. COMPRESSED SORTED INTS
+// ========================================
+// Block format (32-bit words): header (b | exceptions << 8), 4 * b packed
+// words, exception positions (4 per word), exception high bits.
+// Usage: CompressedSortedInts c(sortedArr, n); c.search(x); c.decode(out)
+class CompressedSortedInts {
+    vector<uint32_t> data;
+    vector<int> blockFirst;   // skip pointers: first value of each block
+    vector<int> blockLast;    // ... last value
+    vector<size_t> blockOffset;
+    size_t n;
+
+    void encodeBlock(const int* values) {
+        uint32_t deltas[CBLOCK];
+        for (size_t i = 0; i < CBLOCK; i++) {
+            uint32_t prev = i < 4 ? (uint32_t)values[0] : (uint32_t)values[i - 4];
+            deltas[i] = (uint32_t)values[i] - prev;
+        }
+
+        // Width minimizing packed bits + 40 bits per exception
+        int widthCount[33] = {0};
+        for (uint32_t d : deltas) widthCount[bitWidth(d)]++;
+        int bestB = 32;
+        size_t bestCost = CBLOCK * 32, exceptions = 0;
+        for (int b = 32; b >= 0; b--) {
+            size_t cost = CBLOCK * b + exceptions * 40;
+            if (cost <= bestCost) {
+                bestCost = cost;
+                bestB = b;
+            }
+            exceptions += widthCount[b];
+        }
+
+        vector<uint8_t> pos;
+        vector<uint32_t> high;
+        for (size_t i = 0; bestB < 32 && i < CBLOCK; i++) {
+            if (deltas[i] >> bestB) {
+                pos.push_back((uint8_t)i);
+                high.push_back(deltas[i] >> bestB);
+            }
+        }
+
+        size_t start = data.size();
+        size_t posWords = (pos.size() + 3) / 4;
+        data.resize(start + 1 + 4 * bestB + posWords + high.size());
+        uint32_t* out = data.data() + start;
+        out[0] = (uint32_t)bestB | (uint32_t)pos.size() << 8;
+        packBlock(deltas, bestB, out + 1);
+        if (!pos.empty()) memcpy(out + 1 + 4 * bestB, pos.data(), pos.size());
+        for (size_t e = 0; e < high.size(); e++) out[1 + 4 * bestB + posWords + e] = high[e];
+    }
+
+public:
+    class Cursor;
+
+    CompressedSortedInts(const int* sorted, size_t count) : n(count) {
+        size_t blocks = (count + CBLOCK - 1) / CBLOCK;
+        blockFirst.reserve(blocks);
+        blockLast.reserve(blocks);
+        blockOffset.reserve(blocks);
+        int padded[CBLOCK];
+        for (size_t start = 0; start < count; start += CBLOCK) {
+            size_t len = min(CBLOCK, count - start);
+            const int* values = sorted + start;
+            if (len < CBLOCK) {
+                // Last block: repeat the last value (zero deltas)
+                copy(values, values + len, padded);
+                fill(padded + len, padded + CBLOCK, values[len - 1]);
+                values = padded;
+            }
+            blockFirst.push_back(values[0]);
+            blockLast.push_back(values[len - 1]);
+            blockOffset.push_back(data.size());
+            encodeBlock(values);
+        }
+        data.shrink_to_fit();
+    }
+
+    size_t size() const { return n; }
+    size_t blocks() const { return blockFirst.size(); }
+
+    size_t memoryBytes() const {
+        return data.size() * sizeof(uint32_t) + blocks() * (2 * sizeof(int) + sizeof(size_t));
+    }
+
+    // Decodes block b into out (room for 128); returns the number of values
+    size_t decodeBlock(size_t b, int* out) const {
+        const uint32_t* in = data.data() + blockOffset[b];
+        int B = in[0] & 0xFF;
+        size_t exceptions = in[0] >> 8;
+        if (exceptions == 0) {
+            BlockCodec::decode[B](in + 1, blockFirst[b], out);
+        } else {
+            alignas(16) uint32_t deltas[CBLOCK];
+            BlockCodec::unpack[B](in + 1, deltas);
+            const uint8_t* pos = (const uint8_t*)(in + 1 + 4 * B);
+            const uint32_t* high = in + 1 + 4 * B + (exceptions + 3) / 4;
+            for (size_t e = 0; e < exceptions; e++) deltas[pos[e]] |= high[e] << B;
+            prefixSumLanes(deltas, blockFirst[b], out);
+        }
+        return b + 1 < blocks() ? CBLOCK : n - b * CBLOCK;
+    }
+
+    // Decodes everything into out (room for size())
+    void decode(int* out) const {
+        size_t full = n / CBLOCK;
+        for (size_t b = 0; b < full; b++) decodeBlock(b, out + b * CBLOCK);
+        if (full < blocks()) {
+            int tail[CBLOCK];
+            size_t len = decodeBlock(full, tail);
+            copy(tail, tail + len, out + full * CBLOCK);
+        }
+    }
+
+    // Index of the first value >= x, or size() if none
+    size_t lowerBound(int x) const {
+        size_t b = lower_bound(blockLast.begin(), blockLast.end(), x) - blockLast.begin();
+        if (b == blocks()) return n;
+        int buf[CBLOCK];
+        size_t len = decodeBlock(b, buf);
+        return b * CBLOCK + (lower_bound(buf, buf + len, x) - buf);
+    }
+
+    // Same contract as binarySearch: an index of x, or -1
+    long long search(int x) const {
+        size_t b = lower_bound(blockLast.begin(), blockLast.end(), x) - blockLast.begin();
+        if (b == blocks() || blockFirst[b] > x) return -1;
+        int buf[CBLOCK];
+        size_t len = decodeBlock(b, buf);
+        int* it = lower_bound(buf, buf + len, x);
+        return it != buf + len && *it == x ? (long long)(b * CBLOCK + (it - buf)) : -1;
+    }
+
+    bool contains(int x) const { return search(x) != -1; }
+};
+
+// Forward iterator over the values, one decoded block at a time.
+// advanceTo(x) jumps over whole blocks with the skip pointers.
+class CompressedSortedInts::Cursor {
+    const CompressedSortedInts& list;
+    size_t block;
+    size_t pos;
+    size_t len;
+    int buf[CBLOCK];
+
+    void load(size_t b) {
+        block = b;
+        pos = 0;
+        len = b < list.blocks() ? list.decodeBlock(b, buf) : 0;
+    }
+
+public:
+    explicit Cursor(const CompressedSortedInts& l) : list(l), block(0), pos(0), len(0) { load(0); }
+
+    bool valid() const { return pos < len; }
+    // Precondition: valid()
+    int value() const { return buf[pos]; }
+
+    void next() {
+        if (++pos == len) load(block + 1);
+    }
+
+    // Moves to the first value >= x (never backwards)
+    void advanceTo(int x) {
+        if (!valid() || buf[pos] >= x) return;
+        if (list.blockLast[block] < x) {
+            auto first = list.blockLast.begin() + block + 1;
+            load(lower_bound(first, list.blockLast.end(), x) - list.blockLast.begin());
+            if (!valid()) return;
+        }
+        // Short hops (similar-size lists) scan; long ones binary search
+        size_t probe = min(pos + 8, len - 1);
+        if (buf[probe] >= x) {
+            while (buf[pos] < x) pos++;
+        } else {
+            pos = lower_bound(buf + probe + 1, buf + len, x) - buf;
+        }
+    }
+
+    // Appends the values < x that remain in the current block and moves
+    // past them (a whole run of the block in one copy)
+    // Precondition: valid() && value() < x
+    void appendBelow(int x, vector<int>& out) {
+        size_t end = pos + 1;
+        while (end < len && end < pos + 8 && buf[end] < x) end++;
+        if (end == pos + 8 && end < len && buf[end] < x) {
+            end = buf[len - 1] < x ? len : lower_bound(buf + end, buf + len, x) - buf;
+        }
+        out.insert(out.end(), buf + pos, buf + end);
+        pos = end;
+        if (pos == len) load(block + 1);
+    }
+};
+
+// ========================================
+// 3. INTERSECTION AND UNION
+// ========================================
+// Multiset semantics, like std::set_intersection / std::set_union.
+// Intersection leapfrogs: the cursor behind jumps to the other's value,
+// skipping blocks without decoding them, so a short list against a long
+// one decodes at most one block of the long list per match.
+// Usage: vector<int> both = intersectCompressed(a, b);
+
+vector<int> intersectCompressed(const CompressedSortedInts& a, const CompressedSortedInts& b) {
+    vector<int> result;
+    CompressedSortedInts::Cursor ca(a), cb(b);
+    while (ca.valid() && cb.valid()) {
+        int x = ca.value(), y = cb.value();
+        if (x < y) {
+            ca.advanceTo(y);
+        } else if (y < x) {
+            cb.advanceTo(x);
+        } else {
+            result.push_back(x);
+            ca.next();
+            cb.next();
+        }
+    }
+    return result;
+}
+
+// Usage: vector<int> either = unionCompressed(a, b);
+vector<int> unionCompressed(const CompressedSortedInts& a, const CompressedSortedInts& b) {
+    vector<int> result;
+    result.reserve(a.size() + b.size());
+    CompressedSortedInts::Cursor ca(a), cb(b);
+    while (ca.valid() && cb.valid()) {
+        int x = ca.value(), y = cb.value();
+        if (x < y) {
+            ca.appendBelow(y, result);
+        } else if (y < x) {
+            cb.appendBelow(x, result);
+        } else {
+            result.push_back(x);
+            ca.next();
+            cb.next();
+        }
+    }
+    for (; ca.valid(); ca.next()) result.push_back(ca.value());
+    for (; cb.valid(); cb.next()) result.push_back(cb.value());
+    return result;
+}
+
+// ========================================
+// BASELINE (copy of core_problems.cpp)
+// ========================================
+
+int binarySearch(int arr[], int n, int key) {
+    int low = 0, high = n - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (arr[mid] == key) {
+            return mid;
+        } else if (arr[mid] < key) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+// ========================================
+// BENCHMARK: MEMORY AND SPEED VS int[]
+// ========================================
+// Usage: benchmarkCompressedInts(n, queries)
+// Example: benchmarkCompressedInts(50000000, 1000000)
+// IDs with gaps of 1..16, plus a 2000-wide gap every ~100 IDs (exceptions)
+void benchmarkCompressedInts(size_t n, size_t queries) {
+    using Clock = chrono::steady_clock;
+    mt19937 rng(15);
+    auto makeIds = [&](size_t count, int gapScale) {
+        vector<int> ids(count);
+        long long v = 0;
+        for (auto& x : ids) {
+            v += 1 + rng() % (16 * gapScale);
+            if (rng() % 100 == 0) v += rng() % 2000;
+            x = (int)v;
+        }
+        return ids;
+    };
+    auto secondsSince = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    vector<int> ids = makeIds(n, 1);
+    CompressedSortedInts comp(ids.data(), n);
+    cout << "values: " << n << ", int[]: " << n * sizeof(int) / (1 << 20) << " MB, compressed: "
+         << comp.memoryBytes() / (1 << 20) << " MB (" << 8.0 * comp.memoryBytes() / n << " bits/int, "
+         << (double)n * sizeof(int) / comp.memoryBytes() << "x smaller)" << endl;
+
+    vector<int> out(n);
+    comp.decode(out.data());
+    auto start = Clock::now();
+    const int ROUNDS = 5;
+    for (int r = 0; r < ROUNDS; r++) comp.decode(out.data());
+    cout << "decode to int[]: " << ROUNDS * n / secondsSince(start) / 1e9 << " billion ints/s (round trip "
+         << (out == ids ? "ok" : "FAILED") << ")" << endl;
+
+    // Block at a time into an L1 buffer, as search / intersection use it
+    long long checksum = 0;
+    int buf[CBLOCK];
+    start = Clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (size_t b = 0; b < comp.blocks(); b++) checksum += buf[comp.decodeBlock(b, buf) - 1];
+    }
+    cout << "decode in cache: " << ROUNDS * n / secondsSince(start) / 1e9 << " billion ints/s" << endl;
+
+    vector<int> q(queries);
+    for (auto& x : q) x = ids[rng() % n] + (int)(rng() % 2);
+    start = Clock::now();
+    for (int x : q) checksum += binarySearch(ids.data(), (int)n, x);
+    double tPlain = secondsSince(start);
+    start = Clock::now();
+    for (int x : q) checksum += comp.search(x);
+    double tComp = secondsSince(start);
+    cout << "search ns/query: int[] binarySearch " << tPlain / queries * 1e9 << ", compressed "
+         << tComp / queries * 1e9 << endl;
+
+    // Intersection / union: similar sizes, then a short list against the long one
+    for (size_t other : {n, n / 1000}) {
+        vector<int> ids2 = makeIds(other, (int)(n / other));
+        CompressedSortedInts comp2(ids2.data(), other);
+        vector<int> plain;
+        start = Clock::now();
+        set_intersection(ids.begin(), ids.end(), ids2.begin(), ids2.end(), back_inserter(plain));
+        double tPlainAnd = secondsSince(start);
+        start = Clock::now();
+        vector<int> both = intersectCompressed(comp, comp2);
+        double tCompAnd = secondsSince(start);
+        vector<int> plainOr;
+        plainOr.reserve(n + other);
+        start = Clock::now();
+        set_union(ids.begin(), ids.end(), ids2.begin(), ids2.end(), back_inserter(plainOr));
+        double tPlainOr = secondsSince(start);
+        start = Clock::now();
+        vector<int> either = unionCompressed(comp, comp2);
+        double tCompOr = secondsSince(start);
+        cout << n << " x " << other << ": intersect int[] " << tPlainAnd * 1e3 << " ms, compressed "
+             << tCompAnd * 1e3 << " ms; union int[] " << tPlainOr * 1e3 << " ms, compressed "
+             << tCompOr * 1e3 << " ms (results " << (plain == both && plainOr == either ? "match" : "DIFFER")
+             << ")" << endl;
+    }
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Compressed Sorted Int Array ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // vector<int> ids;
+    // for (int i = 0; i < 1000; i++) ids.push_back(i * 3);
+    // CompressedSortedInts c(ids.data(), ids.size());
+    // cout << "Memory: " << c.memoryBytes() << " bytes vs " << ids.size() * sizeof(int) << endl;
+
+    // Search (same result as binarySearch)
+    // cout << "Index of 300: " << c.search(300) << endl;
+    // cout << "lower_bound(301): " << c.lowerBound(301) << endl;
+
+    // Decode back to a plain array
+    // vector<int> out(c.size());
+    // c.decode(out.data());
+
+    // Intersection / union on the compressed form
+    // vector<int> evens;
+    // for (int i = 0; i < 1000; i++) evens.push_back(i * 2);
+    // CompressedSortedInts e(evens.data(), evens.size());
+    // cout << "Common IDs: " << intersectCompressed(c, e).size() << endl;
+    // cout << "All IDs: " << unionCompressed(c, e).size() << endl;
+
+    // Memory and speed against int[]
+    // benchmarkCompressedInts(50000000, 1000000);
+
+    return 0;
+}
@@ -95,8 +95,8 @@ void sortArray(int arr[], int n) {
 // Function to find sum of all elements
 // Usage: sum = sumArray(arr, n)
 // Example: sum = sumArray(arr, 5) - returns sum of all 5 elements
-int sumArray(int arr[], int n) {
-    int sum = 0;
+long long sumArray(int arr[], int n) {
+    long long sum = 0;
     for (int i = 0; i < n; i++) {
         sum += arr[i];
     }
@@ -169,7 +169,7 @@ int main() {
     // }
     
     // Find sum
-    // int sum = sumArray(arr, n);
+    // long long sum = sumArray(arr, n);
     // cout << "Sum: " << sum << endl;
     
     // Find average
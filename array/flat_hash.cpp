@@ -0,0 +1,615 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#if defined(__SSE2__)
+#define FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#else
+#define FLAT_HASH_SSE2 0
+#endif
+using namespace std;
+
+// ========================================
+// FLAT HASH MAP / SET (SWISS TABLE)
+// ========================================
+// Concept: twoSum and longestConsecutive in advanced_problems.cpp use
+// std::unordered_map, which allocates one node per element and follows a
+// pointer per lookup. This table stores the elements inline in one array
+// (open addressing) next to a parallel array of 1-byte control codes:
+// - EMPTY / DELETED (negative), or the low 7 bits of the hash (FULL)
+// - Slots are probed 16 at a time: one SSE2 compare of the 16 control
+//   bytes against the 7-bit tag finds the candidates, so almost every
+//   lookup does one key compare and touches one or two cache lines
+// - Groups are probed triangularly (g, g+1, g+3, ...), max load 7/8
+// - Erase leaves a DELETED tombstone only when the group has no EMPTY
+//   slot (otherwise no probe can have passed through it)
+// SSE2 is part of x86-64, so there is no runtime dispatch; other targets
+// use a scalar loop over the group.
+
+const int8_t CTRL_EMPTY = -128;
+const int8_t CTRL_DELETED = -2;
+
+// 16 control bytes; bit i of each mask refers to slot i of the group
+struct CtrlGroup {
+    static constexpr size_t WIDTH = 16;
+
+#if FLAT_HASH_SSE2
+    __m128i ctrl;
+
+    explicit CtrlGroup(const int8_t* p) : ctrl(_mm_load_si128((const __m128i*)p)) {}
+
+    unsigned match(int8_t tag) const {
+        return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag)));
+    }
+    // EMPTY and DELETED are the only codes with the sign bit set
+    unsigned matchEmptyOrDeleted() const { return (unsigned)_mm_movemask_epi8(ctrl); }
+#else
+    const int8_t* ctrl;
+
+    explicit CtrlGroup(const int8_t* p) : ctrl(p) {}
+
+    unsigned match(int8_t tag) const {
+        unsigned m = 0;
+        for (size_t i = 0; i < WIDTH; i++) m |= (unsigned)(ctrl[i] == tag) << i;
+        return m;
+    }
+    unsigned matchEmptyOrDeleted() const {
+        unsigned m = 0;
+        for (size_t i = 0; i < WIDTH; i++) m |= (unsigned)(ctrl[i] < 0) << i;
+        return m;
+    }
+#endif
+
+    unsigned matchEmpty() const { return match(CTRL_EMPTY); }
+};
+
+// ========================================
+// HASH FUNCTIONS
+// ========================================
+// Integers: one multiply by 2^64 / golden ratio, then fold the high half
+// into the low half so both the 7-bit tag (low bits) and the group index
+// (bits 7 and up) depend on every input bit. Identity hashing, as used by
+// std::hash<int>, would put keys like 0, 16, 32, ... in one group.
+// Other keys: std::hash followed by the same fold.
+inline uint64_t foldMix(uint64_t x) {
+    x *= 0x9E3779B97F4A7C15ULL;
+    return x ^ (x >> 32);
+}
+
+template <typename K, typename Enable = void>
+struct FlatHash {
+    size_t operator()(const K& key) const { return (size_t)foldMix(hash<K>()(key)); }
+};
+
+template <typename K>
+struct FlatHash<K, typename enable_if<is_integral<K>::value>::type> {
+    size_t operator()(K key) const { return (size_t)foldMix((uint64_t)key); }
+};
+
+// ========================================
+// TABLE CORE (shared by map and set)
+// ========================================
+// Slot is a struct whose first member is `key`. Capacity is 0 or a power
+// of two >= 16; control bytes are 16-byte aligned for the group loads.
+template <typename Slot, typename Hash>
+class FlatTable {
+public:
+    using Key = decltype(Slot::key);
+    static constexpr size_t NPOS = (size_t)-1;
+
+private:
+    static constexpr size_t GROUP = CtrlGroup::WIDTH;
+
+    int8_t* ctrl;
+    Slot* slots;
+    size_t cap;
+    size_t count;
+    size_t growthLeft;  // inserts into EMPTY slots before the next rehash
+    Hash hasher;
+
+    static size_t maxLoad(size_t c) { return c - c / 8; }
+    static int8_t tagOf(size_t h) { return (int8_t)(h & 0x7F); }
+
+    size_t firstFreeSlot(size_t h) const {
+        size_t mask = cap / GROUP - 1;
+        size_t g = (h >> 7) & mask;
+        for (size_t step = 1;; step++) {
+            unsigned m = CtrlGroup(ctrl + g * GROUP).matchEmptyOrDeleted();
+            if (m) return g * GROUP + __builtin_ctz(m);
+            g = (g + step) & mask;
+        }
+    }
+
+    // Slot index of key (with hash h), or NPOS
+    size_t findIndex(const Key& key, size_t h) const {
+        if (cap == 0) return NPOS;
+        int8_t tag = tagOf(h);
+        size_t mask = cap / GROUP - 1;
+        size_t g = (h >> 7) & mask;
+        for (size_t step = 1;; step++) {
+            CtrlGroup group(ctrl + g * GROUP);
+            for (unsigned m = group.match(tag); m; m &= m - 1) {
+                size_t i = g * GROUP + __builtin_ctz(m);
+                if (slots[i].key == key) return i;
+            }
+            if (group.matchEmpty()) return NPOS;
+            g = (g + step) & mask;
+        }
+    }
+
+    // Move every element into a fresh table of newCap slots (drops tombstones)
+    void resize(size_t newCap) {
+        int8_t* newCtrl = static_cast<int8_t*>(aligned_alloc(GROUP, newCap));
+        if (!newCtrl) throw bad_alloc();
+        Slot* newSlots;
+        try {
+            newSlots = static_cast<Slot*>(::operator new(newCap * sizeof(Slot)));
+        } catch (...) {
+            free(newCtrl);
+            throw;
+        }
+        memset(newCtrl, CTRL_EMPTY, newCap);
+
+        int8_t* oldCtrl = ctrl;
+        Slot* oldSlots = slots;
+        size_t oldCap = cap;
+        ctrl = newCtrl;
+        slots = newSlots;
+        cap = newCap;
+        growthLeft = maxLoad(newCap) - count;
+
+        for (size_t i = 0; i < oldCap; i++) {
+            if (oldCtrl[i] < 0) continue;
+            size_t h = hasher(oldSlots[i].key);
+            size_t j = firstFreeSlot(h);
+            new (slots + j) Slot(std::move(oldSlots[i]));
+            oldSlots[i].~Slot();
+            ctrl[j] = tagOf(h);
+        }
+        free(oldCtrl);
+        ::operator delete(oldSlots);
+    }
+
+    // Out of EMPTY slots: double if mostly live, else purge tombstones
+    void rehashForInsert() {
+        if (cap == 0) resize(GROUP);
+        else if (count >= maxLoad(cap) / 2) resize(cap * 2);
+        else resize(cap);
+    }
+
+    void destroySlots() {
+        if constexpr (!is_trivially_destructible<Slot>::value) {
+            for (size_t i = 0; i < cap; i++) {
+                if (ctrl[i] >= 0) slots[i].~Slot();
+            }
+        }
+    }
+
+public:
+    FlatTable() : ctrl(nullptr), slots(nullptr), cap(0), count(0), growthLeft(0) {}
+
+    FlatTable(const FlatTable&) = delete;
+    FlatTable& operator=(const FlatTable&) = delete;
+
+    FlatTable(FlatTable&& other) noexcept
+        : ctrl(other.ctrl), slots(other.slots), cap(other.cap), count(other.count),
+          growthLeft(other.growthLeft), hasher(std::move(other.hasher)) {
+        other.ctrl = nullptr;
+        other.slots = nullptr;
+        other.cap = other.count = other.growthLeft = 0;
+    }
+
+    FlatTable& operator=(FlatTable&& other) noexcept {
+        swap(ctrl, other.ctrl);
+        swap(slots, other.slots);
+        swap(cap, other.cap);
+        swap(count, other.count);
+        swap(growthLeft, other.growthLeft);
+        swap(hasher, other.hasher);
+        return *this;
+    }
+
+    ~FlatTable() {
+        destroySlots();
+        free(ctrl);
+        ::operator delete(slots);
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return cap; }
+    size_t memoryBytes() const { return cap * (sizeof(Slot) + 1); }
+
+    // Room for n elements without rehashing
+    void reserve(size_t n) {
+        size_t newCap = GROUP;
+        while (maxLoad(newCap) < n) newCap *= 2;
+        if (newCap > cap) resize(newCap);
+    }
+
+    void clear() {
+        destroySlots();
+        count = 0;
+        if (cap) {
+            memset(ctrl, CTRL_EMPTY, cap);
+            growthLeft = maxLoad(cap);
+        }
+    }
+
+    // Slot index of key, or NPOS
+    size_t findIndex(const Key& key) const { return findIndex(key, hasher(key)); }
+
+    Slot* find(const Key& key) {
+        size_t i = findIndex(key);
+        return i == NPOS ? nullptr : slots + i;
+    }
+    const Slot* find(const Key& key) const {
+        size_t i = findIndex(key);
+        return i == NPOS ? nullptr : slots + i;
+    }
+
+    // Insert Slot{key, rest...} unless key is present.
+    // Returns the slot holding key and whether it was inserted.
+    template <typename... Rest>
+    pair<Slot*, bool> emplace(const Key& key, Rest&&... rest) {
+        size_t h = hasher(key);
+        size_t i = findIndex(key, h);
+        if (i != NPOS) return {slots + i, false};
+
+        if (cap == 0) rehashForInsert();
+        i = firstFreeSlot(h);
+        if (growthLeft == 0 && ctrl[i] == CTRL_EMPTY) {
+            rehashForInsert();
+            i = firstFreeSlot(h);
+        }
+        new (slots + i) Slot{key, std::forward<Rest>(rest)...};
+        if (ctrl[i] == CTRL_EMPTY) growthLeft--;
+        ctrl[i] = tagOf(h);
+        count++;
+        return {slots + i, true};
+    }
+
+    bool erase(const Key& key) {
+        size_t i = findIndex(key);
+        if (i == NPOS) return false;
+        slots[i].~Slot();
+        count--;
+        if (CtrlGroup(ctrl + i / GROUP * GROUP).matchEmpty()) {
+            ctrl[i] = CTRL_EMPTY;
+            growthLeft++;
+        } else {
+            ctrl[i] = CTRL_DELETED;
+        }
+        return true;
+    }
+
+    // Calls fn(slot) for every element, in table order
+    template <typename Fn>
+    void forEach(Fn fn) {
+        for (size_t i = 0; i < cap; i++) {
+            if (ctrl[i] >= 0) fn(slots[i]);
+        }
+    }
+};
+
+// ========================================
+// 1. FLAT HASH MAP
+// ========================================
+// Usage: FlatHashMap<int, int> m; m.insert(k, v); m[k]; m.find(k); m.erase(k)
+// Example: m[7] = 1; *m.find(7) is 1, m.find(8) is nullptr
+template <typename K, typename V, typename Hash = FlatHash<K>>
+class FlatHashMap {
+    struct Slot {
+        K key;
+        V value;
+    };
+    FlatTable<Slot, Hash> table;
+
+public:
+    size_t size() const { return table.size(); }
+    bool isEmpty() const { return table.size() == 0; }
+    size_t memoryBytes() const { return table.memoryBytes(); }
+    void reserve(size_t n) { table.reserve(n); }
+    void clear() { table.clear(); }
+
+    // Returns false (and keeps the old value) if key is already present
+    bool insert(const K& key, V value) { return table.emplace(key, std::move(value)).second; }
+
+    // Inserts a value-initialized V if key is absent
+    V& operator[](const K& key) { return table.emplace(key, V()).first->value; }
+
+    // Pointer to the value, or nullptr if key is absent
+    V* find(const K& key) {
+        Slot* s = table.find(key);
+        return s ? &s->value : nullptr;
+    }
+    const V* find(const K& key) const {
+        const Slot* s = table.find(key);
+        return s ? &s->value : nullptr;
+    }
+
+    bool contains(const K& key) const { return table.findIndex(key) != table.NPOS; }
+    bool erase(const K& key) { return table.erase(key); }
+
+    // Calls fn(key, value) for every entry, in no particular order
+    template <typename Fn>
+    void forEach(Fn fn) {
+        table.forEach([&](Slot& s) { fn(s.key, s.value); });
+    }
+};
+
+// ========================================
+// 2. FLAT HASH SET
+// ========================================
+// Usage: FlatHashSet<int> s; s.insert(k); s.contains(k); s.erase(k)
+template <typename K, typename Hash = FlatHash<K>>
+class FlatHashSet {
+    struct Slot {
+        K key;
+    };
+    FlatTable<Slot, Hash> table;
+
+public:
+    size_t size() const { return table.size(); }
+    bool isEmpty() const { return table.size() == 0; }
+    size_t memoryBytes() const { return table.memoryBytes(); }
+    void reserve(size_t n) { table.reserve(n); }
+    void clear() { table.clear(); }
+
+    // Returns false if key is already present
+    bool insert(const K& key) { return table.emplace(key).second; }
+    bool contains(const K& key) const { return table.findIndex(key) != table.NPOS; }
+    bool erase(const K& key) { return table.erase(key); }
+
+    // Calls fn(key) for every element, in no particular order
+    template <typename Fn>
+    void forEach(Fn fn) {
+        table.forEach([&](Slot& s) { fn(s.key); });
+    }
+};
+
+// ========================================
+// 3. TWO SUM (flat hash map)
+// ========================================
+// Concept: Same as advanced_problems.cpp, with the map reserved up front
+// so there is no rehash while scanning. The complement is computed in
+// 64 bits; complements outside int range cannot be in the array.
+// Usage: twoSumFlat(arr, n, target) - prints pairs that sum to target
+// Example: arr = {2, 7, 11, 15}, target = 9 prints "2 + 7 = 9"
+void twoSumFlat(int arr[], int n, int target) {
+    FlatHashMap<int, int> map;
+    map.reserve(n);
+    bool found = false;
+
+    for (int i = 0; i < n; i++) {
+        long long complement = (long long)target - arr[i];
+        if (complement >= INT_MIN && complement <= INT_MAX && map.contains((int)complement)) {
+            cout << complement << " + " << arr[i] << " = " << target << endl;
+            found = true;
+        }
+        map[arr[i]] = i;
+    }
+
+    if (!found) {
+        cout << "No pair found with sum " << target << endl;
+    }
+}
+
+// Counting variant used by the benchmark (no output per pair)
+long long countTwoSumPairsFlat(const int arr[], int n, int target) {
+    FlatHashMap<int, int> seen;
+    seen.reserve(n);
+    long long pairs = 0;
+    for (int i = 0; i < n; i++) {
+        long long complement = (long long)target - arr[i];
+        if (complement >= INT_MIN && complement <= INT_MAX) {
+            const int* c = seen.find((int)complement);
+            if (c) pairs += *c;
+        }
+        seen[arr[i]]++;
+    }
+    return pairs;
+}
+
+// ========================================
+// 4. LONGEST CONSECUTIVE SEQUENCE (flat hash set)
+// ========================================
+// Concept: Same as advanced_problems.cpp, but the outer loop walks the
+// set instead of the array, so a run start that appears many times in
+// the input is only walked once (the original is O(n * run) then).
+// Usage: length = longestConsecutiveFlat(arr, n)
+// Example: arr = {100, 4, 200, 1, 3, 2} returns 4 (sequence: 1, 2, 3, 4)
+int longestConsecutiveFlat(int arr[], int n) {
+    FlatHashSet<int> set;
+    set.reserve(n);
+    for (int i = 0; i < n; i++) {
+        set.insert(arr[i]);
+    }
+
+    int maxLength = 0;
+    set.forEach([&](int start) {
+        if (start != INT_MIN && set.contains(start - 1)) return;
+        int currentNum = start;
+        int currentLength = 1;
+        while (currentNum != INT_MAX && set.contains(currentNum + 1)) {
+            currentNum++;
+            currentLength++;
+        }
+        maxLength = max(maxLength, currentLength);
+    });
+
+    return maxLength;
+}
+
+// ========================================
+// BASELINE (copies of advanced_problems.cpp, without printing)
+// ========================================
+
+long long countTwoSumPairs(const int arr[], int n, int target) {
+    unordered_map<int, int> seen;
+    long long pairs = 0;
+    for (int i = 0; i < n; i++) {
+        auto it = seen.find(target - arr[i]);
+        if (it != seen.end()) pairs += it->second;
+        seen[arr[i]]++;
+    }
+    return pairs;
+}
+
+int longestConsecutive(int arr[], int n) {
+    unordered_map<int, bool> map;
+
+    for (int i = 0; i < n; i++) {
+        map[arr[i]] = true;
+    }
+
+    int maxLength = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (map.find(arr[i] - 1) == map.end()) {
+            int currentNum = arr[i];
+            int currentLength = 1;
+
+            while (map.find(currentNum + 1) != map.end()) {
+                currentNum++;
+                currentLength++;
+            }
+
+            maxLength = max(maxLength, currentLength);
+        }
+    }
+
+    return maxLength;
+}
+
+// ========================================
+// BENCHMARK: FlatHashMap vs std::unordered_map
+// ========================================
+// Usage: benchmarkFlatHash(maxN)
+// Example: benchmarkFlatHash(50000000) - sizes 1K .. 50M keys
+// Keys are random even ints, so odd keys give guaranteed misses.
+void benchmarkFlatHash(size_t maxN) {
+    using Clock = chrono::steady_clock;
+    mt19937 rng(13);
+    cout << "keys  table  insert  lookup-hit  lookup-miss (Mops/s)  bytes/key" << endl;
+
+    vector<size_t> sizes;
+    for (size_t n = 1024; n < maxN; n *= 8) sizes.push_back(n);
+    sizes.push_back(maxN);
+
+    long long checksum = 0;
+    auto mops = [](size_t ops, Clock::time_point start) {
+        double secs = chrono::duration<double>(Clock::now() - start).count();
+        return ops / secs / 1e6;
+    };
+
+    for (size_t n : sizes) {
+        vector<int> keys(n), hits(n), misses(n);
+        for (auto& k : keys) k = (int)(rng() & ~1u);
+        for (size_t i = 0; i < n; i++) {
+            hits[i] = keys[rng() % n];
+            misses[i] = (int)(rng() | 1u);
+        }
+
+        {
+            unordered_map<int, int> m;
+            auto start = Clock::now();
+            for (size_t i = 0; i < n; i++) m[keys[i]] = (int)i;
+            double tIns = mops(n, start);
+            start = Clock::now();
+            for (int k : hits) checksum += m.find(k)->second;
+            double tHit = mops(n, start);
+            start = Clock::now();
+            for (int k : misses) checksum += m.count(k);
+            double tMiss = mops(n, start);
+            // Node (key, value, next, cached hash) + bucket pointer, libstdc++
+            size_t bytes = m.size() * (sizeof(void*) + sizeof(pair<const int, int>) + sizeof(size_t))
+                         + m.bucket_count() * sizeof(void*);
+            cout << n << "  unordered_map  " << tIns << "  " << tHit << "  " << tMiss
+                 << "  " << (double)bytes / n << endl;
+        }
+        {
+            FlatHashMap<int, int> m;
+            auto start = Clock::now();
+            for (size_t i = 0; i < n; i++) m[keys[i]] = (int)i;
+            double tIns = mops(n, start);
+            start = Clock::now();
+            for (int k : hits) checksum += *m.find(k);
+            double tHit = mops(n, start);
+            start = Clock::now();
+            for (int k : misses) checksum += m.contains(k);
+            double tMiss = mops(n, start);
+            cout << n << "  FlatHashMap    " << tIns << "  " << tHit << "  " << tMiss
+                 << "  " << (double)m.memoryBytes() / n << endl;
+        }
+    }
+
+    // Ported problems on the largest size
+    vector<int> arr(maxN);
+    for (auto& x : arr) x = (int)(rng() % (maxN * 2));
+    auto start = Clock::now();
+    long long basePairs = countTwoSumPairs(arr.data(), (int)maxN, (int)maxN);
+    cout << "twoSum (count)          unordered_map: " << mops(maxN, start) << " Melem/s" << endl;
+    start = Clock::now();
+    long long flatPairs = countTwoSumPairsFlat(arr.data(), (int)maxN, (int)maxN);
+    cout << "twoSum (count)          FlatHashMap:   " << mops(maxN, start) << " Melem/s" << endl;
+    start = Clock::now();
+    int baseRun = longestConsecutive(arr.data(), (int)maxN);
+    cout << "longestConsecutive      unordered_map: " << mops(maxN, start) << " Melem/s" << endl;
+    start = Clock::now();
+    int flatRun = longestConsecutiveFlat(arr.data(), (int)maxN);
+    cout << "longestConsecutive      FlatHashSet:   " << mops(maxN, start) << " Melem/s" << endl;
+    cout << "(results agree: " << (basePairs == flatPairs && baseRun == flatRun ? "yes" : "NO")
+         << ", checksum " << checksum << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Flat Hash Map / Set ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // Map
+    // FlatHashMap<int, int> m;
+    // m.insert(10, 1);
+    // m[20] = 2;
+    // cout << "m[20] = " << *m.find(20) << ", contains 30: " << m.contains(30) << endl;
+    // m.erase(10);
+    // cout << "size: " << m.size() << endl;
+
+    // Non-integer keys use std::hash plus the same mixing
+    // FlatHashMap<string, int> words;
+    // words["apple"]++;
+    // words["apple"]++;
+    // cout << "apple: " << *words.find("apple") << endl;
+
+    // Two sum
+    // int arr1[] = {2, 7, 11, 15};
+    // twoSumFlat(arr1, 4, 9);
+
+    // Longest consecutive sequence
+    // int arr2[] = {100, 4, 200, 1, 3, 2};
+    // cout << "Longest consecutive: " << longestConsecutiveFlat(arr2, 6) << endl;
+
+    // Throughput against std::unordered_map
+    // benchmarkFlatHash(50000000);
+
+    return 0;
+}
@@ -0,0 +1,528 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <random>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <memory>
+#if defined(__x86_64__) || defined(__i386__)
+#define SCAN_X86 1
+#include <immintrin.h>
+#else
+#define SCAN_X86 0
+#endif
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread parallel_scan.cpp
+
+// ========================================
+// PARALLEL PREFIX SCAN
+// ========================================
+// Concept: out[i] = in[0] op in[1] op ... op in[i] (inclusive) or the same
+// without in[i] (exclusive), for any associative op with an identity.
+// Large arrays use the two-pass reduce-then-scan pattern:
+// 1. Split into one block per thread; each thread reduces its block
+// 2. A short serial scan of the P block totals gives each block's carry-in
+// 3. Each thread scans its block starting from its carry-in
+// Inside a block, 32/64-bit integer ops with a SIMD hook (PlusOp, MaxOp,
+// MinOp, MultiplyOp for 32-bit) scan eight / four lanes per step in AVX2
+// registers (log-step shifts + carry broadcast); other types run the
+// scalar loop. Reverse scans run right to left (suffix sums, suffix max).
+// Integer overflow wraps on the SIMD path; pick a T wide enough.
+
+bool scanCpuHasAvx2() {
+#if SCAN_X86 && defined(__GNUC__)
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+#else
+    return false;
+#endif
+}
+
+// ========================================
+// OPERATORS
+// ========================================
+
+struct PlusOp {
+    template <typename T>
+    T operator()(T a, T b) const { return a + b; }
+#if SCAN_X86
+    __attribute__((target("avx2"))) static __m256i simd32(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+    __attribute__((target("avx2"))) static __m256i simd64(__m256i a, __m256i b) { return _mm256_add_epi64(a, b); }
+#endif
+};
+
+struct MultiplyOp {
+    template <typename T>
+    T operator()(T a, T b) const { return a * b; }
+#if SCAN_X86
+    __attribute__((target("avx2"))) static __m256i simd32(__m256i a, __m256i b) { return _mm256_mullo_epi32(a, b); }
+#endif
+};
+
+struct MaxOp {
+    template <typename T>
+    T operator()(T a, T b) const { return max(a, b); }
+#if SCAN_X86
+    __attribute__((target("avx2"))) static __m256i simd32(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+    __attribute__((target("avx2"))) static __m256i simd64(__m256i a, __m256i b) {
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a));
+    }
+#endif
+};
+
+struct MinOp {
+    template <typename T>
+    T operator()(T a, T b) const { return min(a, b); }
+#if SCAN_X86
+    __attribute__((target("avx2"))) static __m256i simd32(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+    __attribute__((target("avx2"))) static __m256i simd64(__m256i a, __m256i b) {
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+    }
+#endif
+};
+
+template <typename Op, typename = void>
+struct HasSimd32 : false_type {};
+template <typename Op>
+struct HasSimd32<Op, void_t<decltype(sizeof(&Op::simd32))>> : true_type {};
+
+template <typename Op, typename = void>
+struct HasSimd64 : false_type {};
+template <typename Op>
+struct HasSimd64<Op, void_t<decltype(sizeof(&Op::simd64))>> : true_type {};
+
+template <typename In, typename T, typename Op>
+struct ScanUsesSimd {
+    static const bool value = SCAN_X86 && is_same<In, T>::value && is_integral<T>::value &&
+                              ((sizeof(T) == 4 && HasSimd32<Op>::value) ||
+                               (sizeof(T) == 8 && HasSimd64<Op>::value));
+};
+
+// ========================================
+// BLOCK KERNELS
+// ========================================
+
+// Fold in[lo, hi) in scan order
+template <typename In, typename T, typename Op>
+T reduceRange(const In* in, size_t lo, size_t hi, Op op, T identity, bool reverse) {
+    T acc = identity;
+    if (!reverse) {
+        for (size_t i = lo; i < hi; i++) acc = op(acc, (T)in[i]);
+    } else {
+        for (size_t i = hi; i > lo; i--) acc = op(acc, (T)in[i - 1]);
+    }
+    return acc;
+}
+
+// Scan positions [lo, hi) starting from carry; returns the carry-out
+template <typename In, typename T, typename Op>
+T scanRangeScalar(const In* in, T* out, size_t lo, size_t hi, Op op, T carry, bool inclusive, bool reverse) {
+    for (size_t k = lo; k < hi; k++) {
+        size_t i = reverse ? hi - 1 - (k - lo) : k;
+        T x = (T)in[i];
+        T next = op(carry, x);
+        out[i] = inclusive ? next : carry;
+        carry = next;
+    }
+    return carry;
+}
+
+#if SCAN_X86
+// Vector scan: lane j ends up holding lanes 0..j combined. Shifts that
+// move lanes in fill the vacated lanes with the identity.
+template <typename T, typename Op>
+__attribute__((target("avx2")))
+T scanRangeAvx2(const T* in, T* out, size_t lo, size_t hi, Op op, T carry, T identity,
+                bool inclusive, bool reverse) {
+    const size_t L = 32 / sizeof(T);
+    size_t count = (hi - lo) / L * L;
+    __m256i id, carryVec;
+    if constexpr (sizeof(T) == 4) {
+        id = _mm256_set1_epi32((int32_t)identity);
+        carryVec = _mm256_set1_epi32((int32_t)carry);
+    } else {
+        id = _mm256_set1_epi64x((int64_t)identity);
+        carryVec = _mm256_set1_epi64x((int64_t)carry);
+    }
+    const __m256i reverseLanes = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256i rotateUp = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+
+    for (size_t k = 0; k < count; k += L) {
+        size_t pos = reverse ? hi - k - L : lo + k;
+        __m256i x = _mm256_loadu_si256((const __m256i*)(in + pos));
+        __m256i incl, excl;
+        if constexpr (sizeof(T) == 4) {
+            if (reverse) x = _mm256_permutevar8x32_epi32(x, reverseLanes);
+            x = Op::simd32(_mm256_blend_epi32(_mm256_slli_si256(x, 4), id, 0x11), x);
+            x = Op::simd32(_mm256_blend_epi32(_mm256_slli_si256(x, 8), id, 0x33), x);
+            __m256i low = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+            low = _mm256_blend_epi32(_mm256_permute2x128_si256(low, low, 0x08), id, 0x0F);
+            x = Op::simd32(low, x);
+            incl = Op::simd32(carryVec, x);
+            excl = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(incl, rotateUp), carryVec, 0x01);
+            carryVec = _mm256_permutevar8x32_epi32(incl, _mm256_set1_epi32(7));
+            if (reverse) {
+                incl = _mm256_permutevar8x32_epi32(incl, reverseLanes);
+                excl = _mm256_permutevar8x32_epi32(excl, reverseLanes);
+            }
+        } else {
+            if (reverse) x = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(0, 1, 2, 3));
+            x = Op::simd64(_mm256_blend_epi32(_mm256_slli_si256(x, 8), id, 0x33), x);
+            __m256i low = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2));
+            low = _mm256_blend_epi32(_mm256_permute2x128_si256(low, low, 0x08), id, 0x0F);
+            x = Op::simd64(low, x);
+            incl = Op::simd64(carryVec, x);
+            excl = _mm256_blend_epi32(_mm256_permute4x64_epi64(incl, _MM_SHUFFLE(2, 1, 0, 3)), carryVec, 0x03);
+            carryVec = _mm256_permute4x64_epi64(incl, _MM_SHUFFLE(3, 3, 3, 3));
+            if (reverse) {
+                incl = _mm256_permute4x64_epi64(incl, _MM_SHUFFLE(0, 1, 2, 3));
+                excl = _mm256_permute4x64_epi64(excl, _MM_SHUFFLE(0, 1, 2, 3));
+            }
+        }
+        _mm256_storeu_si256((__m256i*)(out + pos), inclusive ? incl : excl);
+    }
+
+    T c;
+    if constexpr (sizeof(T) == 4) c = (T)_mm256_extract_epi32(carryVec, 0);
+    else c = (T)_mm256_extract_epi64(carryVec, 0);
+    // Remainder: the elements a forward scan reaches last / a reverse scan
+    // reaches last (the low end of the range)
+    if (reverse) return scanRangeScalar(in, out, lo, hi - count, op, c, inclusive, true);
+    return scanRangeScalar(in, out, lo + count, hi, op, c, inclusive, false);
+}
+#endif
+
+template <typename In, typename T, typename Op>
+T scanRange(const In* in, T* out, size_t lo, size_t hi, Op op, T carry, T identity, bool inclusive, bool reverse) {
+#if SCAN_X86
+    if constexpr (ScanUsesSimd<In, T, Op>::value) {
+        if (scanCpuHasAvx2()) return scanRangeAvx2(in, out, lo, hi, op, carry, identity, inclusive, reverse);
+    }
+#endif
+    (void)identity;
+    return scanRangeScalar(in, out, lo, hi, op, carry, inclusive, reverse);
+}
+
+// ========================================
+// PARALLEL DRIVER
+// ========================================
+
+// Runs fn(0) .. fn(tasks - 1), one per thread (the caller runs task 0)
+template <typename Fn>
+void runParallel(size_t tasks, Fn fn) {
+    vector<thread> workers;
+    for (size_t t = 1; t < tasks; t++) workers.emplace_back(fn, t);
+    fn(0);
+    for (auto& w : workers) w.join();
+}
+
+size_t defaultThreads() {
+    size_t hw = thread::hardware_concurrency();
+    return hw == 0 ? 1 : hw;
+}
+
+template <typename In, typename T, typename Op>
+void parallelScan(const In* in, T* out, size_t n, Op op, T identity, bool inclusive, bool reverse, size_t threads) {
+    const size_t MIN_PER_THREAD = 1 << 16;
+    size_t P = min(threads == 0 ? defaultThreads() : threads, max<size_t>(1, n / MIN_PER_THREAD));
+    if (P <= 1) {
+        scanRange(in, out, 0, n, op, identity, identity, inclusive, reverse);
+        return;
+    }
+
+    vector<size_t> bound(P + 1);
+    for (size_t p = 0; p <= P; p++) bound[p] = n * p / P;
+
+    // Pass 1: block totals
+    vector<T> total(P);
+    runParallel(P, [&](size_t p) { total[p] = reduceRange(in, bound[p], bound[p + 1], op, identity, reverse); });
+
+    // Carry-in of each block, in scan order
+    vector<T> carry(P, identity);
+    if (!reverse) {
+        for (size_t p = 1; p < P; p++) carry[p] = op(carry[p - 1], total[p - 1]);
+    } else {
+        for (size_t p = P - 1; p > 0; p--) carry[p - 1] = op(carry[p], total[p]);
+    }
+
+    // Pass 2: scan each block from its carry-in
+    runParallel(P, [&](size_t p) {
+        scanRange(in, out, bound[p], bound[p + 1], op, carry[p], identity, inclusive, reverse);
+    });
+}
+
+// Usage: inclusiveScan(in, out, n, op, identity [, threads, reverse])
+// Example: inclusiveScan(arr, out, 4, PlusOp(), 0) on {1, 2, 3, 4} gives {1, 3, 6, 10}
+//          in == out is allowed
+template <typename In, typename T, typename Op>
+void inclusiveScan(const In* in, T* out, size_t n, Op op, T identity, size_t threads = 0, bool reverse = false) {
+    parallelScan(in, out, n, op, identity, true, reverse, threads);
+}
+
+// Usage: exclusiveScan(in, out, n, op, identity [, threads, reverse])
+// Example: exclusiveScan(arr, out, 4, PlusOp(), 0) on {1, 2, 3, 4} gives {0, 1, 3, 6}
+template <typename In, typename T, typename Op>
+void exclusiveScan(const In* in, T* out, size_t n, Op op, T identity, size_t threads = 0, bool reverse = false) {
+    parallelScan(in, out, n, op, identity, false, reverse, threads);
+}
+
+// Parallel sum of f(i) for i in [0, n)
+template <typename Fn>
+long long parallelSum(size_t n, size_t threads, Fn f) {
+    size_t P = min(threads == 0 ? defaultThreads() : threads, max<size_t>(1, n / (1 << 16)));
+    vector<long long> partial(P, 0);
+    runParallel(P, [&](size_t p) {
+        long long s = 0;
+        for (size_t i = n * p / P; i < n * (p + 1) / P; i++) s += f(i);
+        partial[p] = s;
+    });
+    return accumulate(partial.begin(), partial.end(), 0LL);
+}
+
+// ========================================
+// 1. PRODUCT OF ARRAY EXCEPT SELF (on scans)
+// ========================================
+// Concept: result[i] = (exclusive prefix product) * (exclusive suffix product)
+// Usage: productExceptSelfScan(arr, n, result [, threads])
+// Example: arr = {1, 2, 3, 4} -> result = {24, 12, 8, 6}
+void productExceptSelfScan(const int* arr, size_t n, long long result[], size_t threads = 0) {
+    vector<long long> suffix(n);
+    exclusiveScan(arr, result, n, MultiplyOp(), 1LL, threads);
+    exclusiveScan(arr, suffix.data(), n, MultiplyOp(), 1LL, threads, true);
+    size_t P = min(threads == 0 ? defaultThreads() : threads, max<size_t>(1, n / (1 << 16)));
+    runParallel(P, [&](size_t p) {
+        for (size_t i = n * p / P; i < n * (p + 1) / P; i++) result[i] *= suffix[i];
+    });
+}
+
+// ========================================
+// 2. TRAPPING RAIN WATER (on scans)
+// ========================================
+// Concept: water[i] = min(prefix max, suffix max) - height[i].
+// - Suffix max: reverse max-scan into one buffer
+// - Prefix max: each thread's carry-in is an exclusive max-scan of the
+//   block maxima; the thread then max-scans one L1-sized tile at a time
+//   and sums that tile, so the prefix max is never stored in full
+// Usage: water = trappingRainWaterScan(arr, n [, threads])
+// Example: arr = {0, 1, 0, 2, 1, 0, 1, 3, 2, 1, 2, 1} returns 6
+long long trappingRainWaterScan(const int* arr, size_t n, size_t threads = 0) {
+    if (n <= 2) return 0;
+    unique_ptr<int[]> rightMax(new int[n]);
+    inclusiveScan(arr, rightMax.get(), n, MaxOp(), INT_MIN, threads, true);
+
+    size_t P = min(threads == 0 ? defaultThreads() : threads, max<size_t>(1, n / (1 << 16)));
+    vector<int> blockMax(P), leftCarry(P);
+    runParallel(P, [&](size_t p) {
+        blockMax[p] = reduceRange(arr, n * p / P, n * (p + 1) / P, MaxOp(), INT_MIN, false);
+    });
+    exclusiveScan(blockMax.data(), leftCarry.data(), P, MaxOp(), INT_MIN, 1);
+
+    vector<long long> partial(P);
+    runParallel(P, [&](size_t p) {
+        const size_t TILE = 2048;
+        int leftMax[TILE];
+        int carry = leftCarry[p];
+        long long water = 0;
+        for (size_t i = n * p / P, hi = n * (p + 1) / P; i < hi; i += TILE) {
+            size_t m = min(TILE, hi - i);
+            carry = scanRange(arr + i, leftMax, 0, m, MaxOp(), carry, INT_MIN, true, false);
+            for (size_t j = 0; j < m; j++) water += min(leftMax[j], rightMax[i + j]) - arr[i + j];
+        }
+        partial[p] = water;
+    });
+    return accumulate(partial.begin(), partial.end(), 0LL);
+}
+
+// ========================================
+// 3. FIND SUBARRAY WITH GIVEN SUM (on scans)
+// ========================================
+// Concept: With prefix sums P (P[0] = 0), arr[i..j-1] sums to target iff
+// P[j] - P[i] == target.
+// - Non-negative input: P is non-decreasing, so every thread takes a range
+//   of end positions j and walks a lower_bound pointer for P[j] - target;
+//   the match with the smallest end wins.
+// - Input with negatives: serial hash map of prefix sums seen so far.
+// Usage: found = findSubarrayWithSumScan(arr, n, target, start, end [, threads])
+// Example: arr = {1, 4, 20, 3, 10, 5}, target = 33 -> start = 2, end = 4
+bool findSubarrayWithSumScan(const int* arr, size_t n, long long target, size_t& start, size_t& end,
+                             size_t threads = 0) {
+    vector<long long> prefix(n + 1);
+    prefix[0] = 0;
+    inclusiveScan(arr, prefix.data() + 1, n, PlusOp(), 0LL, threads);
+
+    bool nonNegative = parallelSum(n, threads, [&](size_t i) { return arr[i] < 0 ? 1 : 0; }) == 0;
+    if (!nonNegative) {
+        unordered_map<long long, size_t> firstSeen;
+        for (size_t j = 0; j <= n; j++) {
+            auto it = firstSeen.find(prefix[j] - target);
+            if (it != firstSeen.end() && it->second < j) {
+                start = it->second;
+                end = j - 1;
+                return true;
+            }
+            firstSeen.emplace(prefix[j], j);
+        }
+        return false;
+    }
+
+    size_t P = min(threads == 0 ? defaultThreads() : threads, max<size_t>(1, n / (1 << 16)));
+    const size_t NONE = (size_t)-1;
+    vector<size_t> bestEnd(P, NONE), bestStart(P, 0);
+    runParallel(P, [&](size_t p) {
+        size_t jLo = 1 + n * p / P, jHi = 1 + n * (p + 1) / P;
+        if (jLo >= jHi) return;
+        size_t i = lower_bound(prefix.begin(), prefix.begin() + jLo, prefix[jLo] - target) - prefix.begin();
+        for (size_t j = jLo; j < jHi; j++) {
+            long long want = prefix[j] - target;
+            while (i < j && prefix[i] < want) i++;
+            if (i < j && prefix[i] == want) {
+                bestEnd[p] = j - 1;
+                bestStart[p] = i;
+                return;
+            }
+        }
+    });
+    for (size_t p = 0; p < P; p++) {
+        if (bestEnd[p] != NONE) {
+            start = bestStart[p];
+            end = bestEnd[p];
+            return true;
+        }
+    }
+    return false;
+}
+
+// ========================================
+// BASELINE (copies of advanced_problems.cpp, without printing)
+// ========================================
+
+void productExceptSelf(int arr[], int n, int result[]) {
+    result[0] = 1;
+    for (int i = 1; i < n; i++) {
+        result[i] = result[i - 1] * arr[i - 1];
+    }
+    int rightProduct = 1;
+    for (int i = n - 1; i >= 0; i--) {
+        result[i] *= rightProduct;
+        rightProduct *= arr[i];
+    }
+}
+
+int trappingRainWater(int arr[], int n) {
+    if (n <= 2) return 0;
+    int left = 0, right = n - 1;
+    int leftMax = 0, rightMax = 0;
+    int water = 0;
+    while (left < right) {
+        if (arr[left] < arr[right]) {
+            if (arr[left] >= leftMax) leftMax = arr[left];
+            else water += leftMax - arr[left];
+            left++;
+        } else {
+            if (arr[right] >= rightMax) rightMax = arr[right];
+            else water += rightMax - arr[right];
+            right--;
+        }
+    }
+    return water;
+}
+
+// ========================================
+// BENCHMARK
+// ========================================
+// Usage: benchmarkParallelScan(n)
+// Example: benchmarkParallelScan(200000000) - 200M ints, 1 .. hardware threads
+void benchmarkParallelScan(size_t n) {
+    using Clock = chrono::steady_clock;
+    auto msSince = [](Clock::time_point t) {
+        return chrono::duration<double, milli>(Clock::now() - t).count();
+    };
+
+    vector<int> data(n);
+    mt19937 rng(11);
+    for (auto& x : data) x = (int)(rng() % 100);
+    vector<int> out32(n);
+    vector<long long> out64(n);
+
+    auto start = Clock::now();
+    partial_sum(data.begin(), data.end(), out32.begin());
+    double serial = msSince(start);
+    cout << "n = " << n << ", AVX2: " << (scanCpuHasAvx2() ? "yes" : "no") << endl;
+    cout << "std::partial_sum (int32): " << serial << " ms, "
+         << 2.0 * n * sizeof(int) / serial / 1e6 << " GB/s" << endl;
+
+    vector<size_t> threadCounts;
+    for (size_t t = 1; t < defaultThreads(); t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(defaultThreads());
+
+    for (size_t t : threadCounts) {
+        start = Clock::now();
+        inclusiveScan(data.data(), out32.data(), n, PlusOp(), 0, t);
+        double plus32 = msSince(start);
+
+        start = Clock::now();
+        inclusiveScan(data.data(), out64.data(), n, PlusOp(), 0LL, t);
+        double widen64 = msSince(start);
+
+        start = Clock::now();
+        long long water = trappingRainWaterScan(data.data(), n, t);
+        double rain = msSince(start);
+
+        cout << t << " threads: scan int32 " << plus32 << " ms (" << 2.0 * n * sizeof(int) / plus32 / 1e6
+             << " GB/s), scan int32->int64 " << widen64 << " ms, rain water " << rain << " ms (" << water << ")"
+             << endl;
+    }
+
+    vector<int> small(data.begin(), data.begin() + min<size_t>(n, INT_MAX / 2));
+    start = Clock::now();
+    int serialWater = trappingRainWater(small.data(), (int)small.size());
+    cout << "Serial trappingRainWater: " << msSince(start) << " ms (" << serialWater << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Parallel Prefix Scan ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // int arr[] = {1, 2, 3, 4};
+    // int out[4];
+    // inclusiveScan(arr, out, 4, PlusOp(), 0);             // {1, 3, 6, 10}
+    // exclusiveScan(arr, out, 4, PlusOp(), 0);             // {0, 1, 3, 6}
+    // inclusiveScan(arr, out, 4, MaxOp(), INT_MIN, 0, true); // suffix max {4, 4, 4, 4}
+
+    // Product of array except self
+    // long long products[4];
+    // productExceptSelfScan(arr, 4, products);
+    // for (long long p : products) cout << p << " ";
+    // cout << endl;
+
+    // Trapping rain water
+    // int terrain[] = {0, 1, 0, 2, 1, 0, 1, 3, 2, 1, 2, 1};
+    // cout << "Water trapped: " << trappingRainWaterScan(terrain, 12) << " units" << endl;
+
+    // Subarray with given sum
+    // int values[] = {1, 4, 20, 3, 10, 5};
+    // size_t s, e;
+    // if (findSubarrayWithSumScan(values, 6, 33, s, e)) {
+    //     cout << "Sum found between index " << s << " and " << e << endl;
+    // } else {
+    //     cout << "No subarray found with sum 33" << endl;
+    // }
+
+    // Scaling benchmark
+    // benchmarkParallelScan(200000000);
+
+    return 0;
+}
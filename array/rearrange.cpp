@@ -0,0 +1,485 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#if defined(__x86_64__) || defined(__i386__)
+#define REARRANGE_X86 1
+#include <immintrin.h>
+#else
+#define REARRANGE_X86 0
+#endif
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread rearrange.cpp
+
+// ========================================
+// IN-PLACE PARALLEL REVERSE / ROTATE / MERGE
+// ========================================
+// Concept: reverseArray (core_problems.cpp), rotateArray and
+// mergeSortedArrays (advanced_problems.cpp) rebuilt for large arrays:
+// - Reverse: swap 32-byte blocks from both ends, reversing each block in
+//   a register with a byte shuffle + lane swap (AVX2); the pairs of blocks
+//   are split evenly across threads
+// - Rotate: triple reversal on top of the parallel reverse; the two
+//   partial reversals run as one parallel phase
+// - Merge: merge path - a binary search on each cross diagonal finds where
+//   output position d comes from, so every thread merges exactly
+//   (n1 + n2) / P outputs with no synchronization
+// - In-place merge: split at the middle diagonal, rotate the two inner
+//   pieces into place, recurse on both halves (O(log n) stack, no buffer)
+// All operations work on any trivially copyable T; the SIMD reverse is
+// used for 1, 2, 4 and 8-byte elements.
+
+bool rearrangeCpuHasAvx2() {
+#if REARRANGE_X86 && defined(__GNUC__)
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+#else
+    return false;
+#endif
+}
+
+// Elements per thread below which splitting is not worth a thread start
+const size_t REARRANGE_MIN_PER_THREAD = 1 << 16;
+
+// fn(0) on this thread, fn(1) .. fn(tasks - 1) on new threads
+template <typename Fn>
+void runParallel(size_t tasks, Fn fn) {
+    vector<thread> workers;
+    for (size_t t = 1; t < tasks; t++) workers.emplace_back(fn, t);
+    fn(0);
+    for (auto& w : workers) w.join();
+}
+
+size_t pickThreads(size_t threads, size_t work) {
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    return max<size_t>(1, min(threads, work / REARRANGE_MIN_PER_THREAD));
+}
+
+// ========================================
+// 1. SIMD REVERSE
+// ========================================
+// Concept: swapReversed(x, yEnd, len) swaps x[k] with yEnd[-1 - k] for
+// k < len, i.e. the first len elements with the last len elements in
+// mirrored order. Reversing arr[0..n) is swapReversed(arr, arr + n, n / 2).
+// The two ranges must not overlap.
+
+template <typename T>
+void swapReversedScalar(T* x, T* yEnd, size_t len) {
+    for (size_t k = 0; k < len; k++) swap(x[k], yEnd[-1 - (ptrdiff_t)k]);
+}
+
+#if REARRANGE_X86
+// Reverses the T elements of a 32-byte register: shuffle_epi8 reverses
+// them inside each 128-bit lane, then the two lanes are exchanged
+template <size_t S>
+__attribute__((target("avx2")))
+__m256i reverseMaskAvx2() {
+    alignas(32) int8_t idx[32];
+    for (int b = 0; b < 32; b++) {
+        int inLane = b % 16;
+        idx[b] = (int8_t)((16 / S - 1 - inLane / S) * S + inLane % S);
+    }
+    return _mm256_load_si256((const __m256i*)idx);
+}
+
+template <typename T>
+__attribute__((target("avx2")))
+void swapReversedAvx2(T* x, T* yEnd, size_t len) {
+    const size_t W = 32 / sizeof(T);
+    const __m256i mask = reverseMaskAvx2<sizeof(T)>();
+    size_t k = 0;
+    for (; k + W <= len; k += W) {
+        __m256i vx = _mm256_loadu_si256((const __m256i*)(x + k));
+        __m256i vy = _mm256_loadu_si256((const __m256i*)(yEnd - k - W));
+        vx = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(vx, mask), 0x4E);
+        vy = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(vy, mask), 0x4E);
+        _mm256_storeu_si256((__m256i*)(x + k), vy);
+        _mm256_storeu_si256((__m256i*)(yEnd - k - W), vx);
+    }
+    swapReversedScalar(x + k, yEnd - k, len - k);
+}
+#endif
+
+template <typename T>
+void swapReversed(T* x, T* yEnd, size_t len) {
+#if REARRANGE_X86
+    if constexpr (is_trivially_copyable<T>::value &&
+                  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) {
+        if (rearrangeCpuHasAvx2()) {
+            swapReversedAvx2(x, yEnd, len);
+            return;
+        }
+    }
+#endif
+    swapReversedScalar(x, yEnd, len);
+}
+
+// Usage: reverseSimd(arr, n) - single thread
+template <typename T>
+void reverseSimd(T* arr, size_t n) {
+    swapReversed(arr, arr + n, n / 2);
+}
+
+// Reverses a[0..na) and b[0..nb) (disjoint) as one parallel job: the
+// na / 2 + nb / 2 swaps are split evenly, so a thread may work on both
+template <typename T>
+void reverseTwoParallel(T* a, size_t na, T* b, size_t nb, size_t threads) {
+    size_t ha = na / 2, hb = nb / 2, total = ha + hb;
+    size_t P = pickThreads(threads, total);
+    runParallel(P, [&](size_t p) {
+        size_t lo = total * p / P, hi = total * (p + 1) / P;
+        if (lo < ha) {
+            size_t end = min(hi, ha);
+            swapReversed(a + lo, a + na - lo, end - lo);
+        }
+        if (hi > ha) {
+            size_t start = max(lo, ha) - ha, end = hi - ha;
+            swapReversed(b + start, b + nb - start, end - start);
+        }
+    });
+}
+
+// Usage: parallelReverse(arr, n [, threads]) - threads = 0 uses all cores
+template <typename T>
+void parallelReverse(T* arr, size_t n, size_t threads = 0) {
+    reverseTwoParallel(arr, n, arr, 0, threads);
+}
+
+// Usage: reverseArrayFast(arr, n) - same output as reverseArray
+void reverseArrayFast(int arr[], int n) {
+    parallelReverse(arr, (size_t)max(n, 0));
+    cout << "Array reversed." << endl;
+}
+
+// ========================================
+// 2. ROTATE (TRIPLE REVERSAL)
+// ========================================
+// Concept: rotate right by k = reverse all, then reverse [0, k) and
+// [k, n). Each element is swapped twice, always with sequential SIMD
+// access from both ends, and both phases are split across threads.
+// Usage: rotateRightParallel(arr, n, k [, threads])
+// Example: {1, 2, 3, 4, 5}, k = 2 becomes {4, 5, 1, 2, 3}
+
+template <typename T>
+void rotateRightParallel(T* arr, size_t n, size_t k, size_t threads = 0) {
+    if (n == 0) return;
+    k %= n;
+    if (k == 0) return;
+    parallelReverse(arr, n, threads);
+    reverseTwoParallel(arr, k, arr + k, n - k, threads);
+}
+
+// Single-threaded left rotation of [0, n) by s, used by the in-place merge
+template <typename T>
+void rotateLeftSerial(T* arr, size_t n, size_t s) {
+    if (s == 0 || s == n) return;
+    reverseSimd(arr, s);
+    reverseSimd(arr + s, n - s);
+    reverseSimd(arr, n);
+}
+
+// Usage: rotateArrayFast(arr, n, k) - same output as rotateArray; also
+// accepts negative k (rotate left) and n == 0
+void rotateArrayFast(int arr[], int n, int k) {
+    if (n <= 0) {
+        cout << "Array rotated by 0 positions." << endl;
+        return;
+    }
+    k %= n;
+    if (k < 0) k += n;
+    rotateRightParallel(arr, (size_t)n, (size_t)k);
+    cout << "Array rotated by " << k << " positions." << endl;
+}
+
+// ========================================
+// 3. MERGE PATH PARALLEL MERGE
+// ========================================
+// Concept: Output position d of merge(a, b) is reached after taking i
+// elements of a and d - i of b. mergePathSplit finds that i with a binary
+// search along the diagonal (ties go to a, so the merge is stable).
+// Thread p merges outputs [N*p/P, N*(p+1)/P) independently.
+
+template <typename T>
+size_t mergePathSplit(const T* a, size_t n1, const T* b, size_t n2, size_t diag) {
+    size_t lo = diag > n2 ? diag - n2 : 0;
+    size_t hi = min(diag, n1);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (b[diag - mid - 1] < a[mid]) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo;
+}
+
+// Serial merge of a[0..n1) and b[0..n2) into out (stable)
+template <typename T>
+void mergeSerial(const T* a, size_t n1, const T* b, size_t n2, T* out) {
+    const T* aEnd = a + n1;
+    const T* bEnd = b + n2;
+    while (a != aEnd && b != bEnd) {
+        if (*b < *a) *out++ = *b++;
+        else *out++ = *a++;
+    }
+    out = copy(a, aEnd, out);
+    copy(b, bEnd, out);
+}
+
+// Usage: parallelMerge(a, n1, b, n2, out [, threads])
+// out must have room for n1 + n2 and not overlap a or b
+template <typename T>
+void parallelMerge(const T* a, size_t n1, const T* b, size_t n2, T* out, size_t threads = 0) {
+    size_t total = n1 + n2;
+    size_t P = pickThreads(threads, total);
+    runParallel(P, [&](size_t p) {
+        size_t d0 = total * p / P, d1 = total * (p + 1) / P;
+        size_t i0 = mergePathSplit(a, n1, b, n2, d0);
+        size_t i1 = mergePathSplit(a, n1, b, n2, d1);
+        mergeSerial(a + i0, i1 - i0, b + (d0 - i0), (d1 - i1) - (d0 - i0), out + d0);
+    });
+}
+
+// Usage: mergeSortedArraysFast(arr1, n1, arr2, n2, result) - same output as
+// mergeSortedArrays
+void mergeSortedArraysFast(int arr1[], int n1, int arr2[], int n2, int result[]) {
+    parallelMerge(arr1, (size_t)n1, arr2, (size_t)n2, result);
+    cout << "Arrays merged." << endl;
+}
+
+// ========================================
+// 4. IN-PLACE MERGE (NO BUFFER)
+// ========================================
+// Concept: arr[0..mid) and arr[mid..n) are sorted. Split both at the
+// middle diagonal (i from the left run, j from the right run, i + j =
+// n / 2), rotate arr[i..mid+j) so the j right-run elements come first;
+// now arr[0..n/2) and arr[n/2..n) are two independent smaller merges.
+// Once one run fits in a fixed 4 KB stack buffer, it is copied out and
+// merged linearly (still O(1) extra memory).
+// Time: O(n log n) moves, Space: O(log n) stack.
+// The two halves run on separate threads near the top of the recursion.
+// Usage: mergeInPlace(arr, mid, n [, threads])
+// Example: {1, 4, 7, 2, 3, 9}, mid = 3 becomes {1, 2, 3, 4, 7, 9}
+
+template <typename T>
+void mergeInPlace(T* arr, size_t mid, size_t n, size_t threads = 0) {
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    if (mid == 0 || mid == n || !(arr[mid] < arr[mid - 1])) return;
+
+    if constexpr (is_trivially_copyable<T>::value) {
+        const size_t BUF = 4096 / sizeof(T);
+        T buf[BUF];
+        if (mid <= BUF) {
+            // Left run into buf, merge forwards (writes never pass j)
+            memcpy(buf, arr, mid * sizeof(T));
+            size_t i = 0, j = mid, k = 0;
+            while (i < mid && j < n) arr[k++] = arr[j] < buf[i] ? arr[j++] : buf[i++];
+            memcpy(arr + k, buf + i, (mid - i) * sizeof(T));
+            return;
+        }
+        if (n - mid <= BUF) {
+            // Right run into buf, merge backwards
+            size_t m2 = n - mid;
+            memcpy(buf, arr + mid, m2 * sizeof(T));
+            size_t i = mid, j = m2, k = n;
+            while (i > 0 && j > 0) arr[--k] = buf[j - 1] < arr[i - 1] ? arr[--i] : buf[--j];
+            memcpy(arr, buf, j * sizeof(T));
+            return;
+        }
+    }
+
+    if (n <= 32) {
+        // Insertion of the right run
+        for (size_t r = mid; r < n; r++) {
+            T v = std::move(arr[r]);
+            size_t k = r;
+            while (k > 0 && v < arr[k - 1]) {
+                arr[k] = std::move(arr[k - 1]);
+                k--;
+            }
+            arr[k] = std::move(v);
+        }
+        return;
+    }
+
+    size_t diag = n / 2;
+    size_t i = mergePathSplit(arr, mid, arr + mid, n - mid, diag);
+    size_t j = diag - i;
+    rotateLeftSerial(arr + i, (mid - i) + j, mid - i);
+
+    if (threads > 1 && n >= 2 * REARRANGE_MIN_PER_THREAD) {
+        size_t leftThreads = threads / 2;
+        thread left([=] { mergeInPlace(arr, i, diag, leftThreads); });
+        mergeInPlace(arr + diag, mid - i, n - diag, threads - leftThreads);
+        left.join();
+    } else {
+        mergeInPlace(arr, i, diag, 1);
+        mergeInPlace(arr + diag, mid - i, n - diag, 1);
+    }
+}
+
+// Usage: mergeSortedArraysInPlace(arr, n1, n2) - arr holds the first sorted
+// array in [0, n1) and the second in [n1, n1 + n2)
+void mergeSortedArraysInPlace(int arr[], int n1, int n2) {
+    mergeInPlace(arr, (size_t)n1, (size_t)n1 + n2);
+    cout << "Arrays merged in place." << endl;
+}
+
+// ========================================
+// BASELINE (copies of core_problems.cpp / advanced_problems.cpp, without printing)
+// ========================================
+
+void reverseArray(int arr[], int n) {
+    int start = 0, end = n - 1;
+    while (start < end) {
+        swap(arr[start], arr[end]);
+        start++;
+        end--;
+    }
+}
+
+void rotateArray(int arr[], int n, int k) {
+    k = k % n;
+    reverse(arr, arr + n);
+    reverse(arr, arr + k);
+    reverse(arr + k, arr + n);
+}
+
+void mergeSortedArrays(int arr1[], int n1, int arr2[], int n2, int result[]) {
+    int i = 0, j = 0, k = 0;
+    while (i < n1 && j < n2) {
+        if (arr1[i] <= arr2[j]) {
+            result[k++] = arr1[i++];
+        } else {
+            result[k++] = arr2[j++];
+        }
+    }
+    while (i < n1) {
+        result[k++] = arr1[i++];
+    }
+    while (j < n2) {
+        result[k++] = arr2[j++];
+    }
+}
+
+// ========================================
+// BENCHMARK: GB/s OF ARRAY PROCESSED
+// ========================================
+// Usage: benchmarkRearrange(n [, threads])
+// Example: benchmarkRearrange(100000000) - 100M ints (400 MB) per array
+void benchmarkRearrange(size_t n, size_t threads = 0) {
+    using Clock = chrono::steady_clock;
+    cout << "AVX2 reverse: " << (rearrangeCpuHasAvx2() ? "yes" : "no")
+         << ", threads: " << (threads ? threads : thread::hardware_concurrency()) << endl;
+
+    vector<int> arr(n);
+    for (size_t i = 0; i < n; i++) arr[i] = (int)i;
+    long long checksum = 0;
+    auto report = [&](const char* name, size_t bytes, Clock::time_point start) {
+        double secs = chrono::duration<double>(Clock::now() - start).count();
+        cout << name << ": " << bytes / secs / 1e9 << " GB/s" << endl;
+        checksum += arr[n / 3];
+    };
+    size_t bytes = n * sizeof(int);
+
+    auto start = Clock::now();
+    reverseArray(arr.data(), (int)n);
+    report("reverse  baseline            ", bytes, start);
+    start = Clock::now();
+    reverse(arr.begin(), arr.end());
+    report("reverse  std::reverse        ", bytes, start);
+    start = Clock::now();
+    reverseSimd(arr.data(), n);
+    report("reverse  SIMD, 1 thread      ", bytes, start);
+    start = Clock::now();
+    parallelReverse(arr.data(), n, threads);
+    report("reverse  SIMD, parallel      ", bytes, start);
+
+    size_t k = n / 3 + 1;
+    start = Clock::now();
+    rotateArray(arr.data(), (int)n, (int)k);
+    report("rotate   baseline            ", bytes, start);
+    start = Clock::now();
+    rotate(arr.begin(), arr.begin() + (n - k), arr.end());
+    report("rotate   std::rotate         ", bytes, start);
+    start = Clock::now();
+    rotateRightParallel(arr.data(), n, k, threads);
+    report("rotate   triple reversal     ", bytes, start);
+
+    // Two interleaved sorted runs: evens then odds
+    size_t n1 = n / 2, n2 = n - n1;
+    vector<int> a(n1), b(n2), out(n);
+    for (size_t i = 0; i < n1; i++) a[i] = (int)(2 * i);
+    for (size_t i = 0; i < n2; i++) b[i] = (int)(2 * i + 1);
+
+    start = Clock::now();
+    mergeSortedArrays(a.data(), (int)n1, b.data(), (int)n2, out.data());
+    report("merge    baseline            ", bytes, start);
+    start = Clock::now();
+    merge(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+    report("merge    std::merge          ", bytes, start);
+    start = Clock::now();
+    parallelMerge(a.data(), n1, b.data(), n2, out.data(), threads);
+    report("merge    merge path          ", bytes, start);
+    checksum += out[n / 2];
+
+    copy(a.begin(), a.end(), arr.begin());
+    copy(b.begin(), b.end(), arr.begin() + n1);
+    start = Clock::now();
+    inplace_merge(arr.begin(), arr.begin() + n1, arr.end());
+    report("merge    std::inplace_merge  ", bytes, start);
+    cout << "         (std::inplace_merge allocates an n / 2 buffer when it can)" << endl;
+    copy(a.begin(), a.end(), arr.begin());
+    copy(b.begin(), b.end(), arr.begin() + n1);
+    start = Clock::now();
+    mergeInPlace(arr.data(), n1, n, threads);
+    report("merge    in place, no buffer ", bytes, start);
+
+    cout << "(sorted: " << (is_sorted(arr.begin(), arr.end()) ? "yes" : "NO")
+         << ", checksum " << checksum << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== In-Place Parallel Reverse / Rotate / Merge ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // int arr[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    // int n = 10;
+
+    // Reverse
+    // reverseArrayFast(arr, n);
+
+    // Rotate right by 3 (negative k rotates left)
+    // rotateArrayFast(arr, n, 3);
+
+    // Merge into a result buffer
+    // int arr1[] = {1, 3, 5}, arr2[] = {2, 4, 6}, result[6];
+    // mergeSortedArraysFast(arr1, 3, arr2, 3, result);
+
+    // Merge two runs stored back to back, no extra memory
+    // int runs[] = {1, 4, 7, 2, 3, 9};
+    // mergeSortedArraysInPlace(runs, 3, 3);
+    // for (int x : runs) cout << x << " ";
+    // cout << endl;
+
+    // Generic element types
+    // vector<double> d = {1.5, 2.5, 3.5, 4.5};
+    // parallelReverse(d.data(), d.size());
+
+    // Throughput (GB/s)
+    // benchmarkRearrange(100000000);
+
+    return 0;
+}
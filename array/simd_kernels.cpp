@@ -0,0 +1,600 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_X86 0
+#endif
+using namespace std;
+
+// ========================================
+// SIMD ARRAY KERNELS
+// ========================================
+// Concept: Vectorized versions of the scans in core_problems.cpp
+// (sumArray, findMinMax, linearSearch, countOccurrences, checkSorted)
+// - Element types: 32-bit int, 64-bit int, float
+// - Sums accumulate in 64 bits (double for float), like sumArray's long long
+// - AVX2 and SSE4.2 code paths are compiled into the same binary and picked
+//   at runtime from the CPU's feature bits; anything else uses the scalar path
+// - min/max of float arrays containing NaN is unspecified on SIMD paths
+
+enum class SimdLevel { SCALAR = 0, SSE42 = 1, AVX2 = 2 };
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE42: return "sse4.2";
+        default: return "scalar";
+    }
+}
+
+SimdLevel detectSimdLevel() {
+#if SIMD_X86 && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) return SimdLevel::SSE42;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+// Highest level the caller allows (used by the benchmark to compare paths)
+SimdLevel simdLevelCap = SimdLevel::AVX2;
+
+// Usage: setSimdLevel(SimdLevel::SSE42) - never use anything above SSE4.2
+void setSimdLevel(SimdLevel level) {
+    simdLevelCap = level;
+}
+
+SimdLevel currentSimdLevel() {
+    static const SimdLevel detected = detectSimdLevel();
+    return min(detected, simdLevelCap);
+}
+
+template <typename T>
+struct SumOf {
+    using type = long long;
+};
+
+template <>
+struct SumOf<float> {
+    using type = double;
+};
+
+template <typename T>
+struct MinMax {
+    T minVal;
+    T maxVal;
+};
+
+// Two's-complement add, used when combining 64-bit partial sums
+inline long long wrapAdd(long long a, long long b) {
+    return (long long)((unsigned long long)a + (unsigned long long)b);
+}
+
+// ========================================
+// SCALAR KERNELS
+// ========================================
+namespace scalar {
+
+template <typename T>
+typename SumOf<T>::type sum(const T* arr, size_t n) {
+    if constexpr (is_integral<T>::value && sizeof(T) == 8) {
+        // 64-bit elements wrap on overflow, same as the vector lanes
+        unsigned long long total = 0;
+        for (size_t i = 0; i < n; i++) total += (unsigned long long)arr[i];
+        return (long long)total;
+    } else {
+        typename SumOf<T>::type total = 0;
+        for (size_t i = 0; i < n; i++) total += arr[i];
+        return total;
+    }
+}
+
+template <typename T>
+MinMax<T> minMax(const T* arr, size_t n) {
+    MinMax<T> r = {arr[0], arr[0]};
+    for (size_t i = 1; i < n; i++) {
+        if (arr[i] < r.minVal) r.minVal = arr[i];
+        if (arr[i] > r.maxVal) r.maxVal = arr[i];
+    }
+    return r;
+}
+
+template <typename T>
+long long find(const T* arr, size_t n, T key) {
+    for (size_t i = 0; i < n; i++) {
+        if (arr[i] == key) return (long long)i;
+    }
+    return -1;
+}
+
+template <typename T>
+size_t count(const T* arr, size_t n, T key) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; i++) total += (arr[i] == key);
+    return total;
+}
+
+template <typename T>
+bool isSorted(const T* arr, size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        if (arr[i] > arr[i + 1]) return false;
+    }
+    return true;
+}
+
+}  // namespace scalar
+
+#if SIMD_X86
+
+// Kernels shared by every instruction set. Each ISA namespace defines
+// I32Ops / I64Ops / F32Ops with: T, V, LANES, load, set1, eqMask, gtMask
+// (one bit per lane), vmin, vmax, store. The kernels are stamped out once
+// per namespace so each copy is compiled for that namespace's target.
+#define DEFINE_GENERIC_SIMD_KERNELS                                              \
+template <typename Ops>                                                         \
+MinMax<typename Ops::T> minMax(const typename Ops::T* a, size_t n) {            \
+    typedef typename Ops::T T;                                                  \
+    const size_t L = Ops::LANES;                                                \
+    if (n < 2 * L) return scalar::minMax(a, n);                                 \
+    typename Ops::V mn0 = Ops::load(a), mx0 = mn0;                              \
+    typename Ops::V mn1 = Ops::load(a + L), mx1 = mn1;                          \
+    size_t i = 2 * L;                                                           \
+    for (; i + 2 * L <= n; i += 2 * L) {                                        \
+        typename Ops::V v0 = Ops::load(a + i), v1 = Ops::load(a + i + L);       \
+        mn0 = Ops::vmin(mn0, v0); mx0 = Ops::vmax(mx0, v0);                     \
+        mn1 = Ops::vmin(mn1, v1); mx1 = Ops::vmax(mx1, v1);                     \
+    }                                                                           \
+    T lo[L], hi[L];                                                             \
+    Ops::store(lo, Ops::vmin(mn0, mn1));                                        \
+    Ops::store(hi, Ops::vmax(mx0, mx1));                                        \
+    MinMax<T> r = {lo[0], hi[0]};                                               \
+    for (size_t j = 1; j < L; j++) {                                            \
+        if (lo[j] < r.minVal) r.minVal = lo[j];                                 \
+        if (hi[j] > r.maxVal) r.maxVal = hi[j];                                 \
+    }                                                                           \
+    for (; i < n; i++) {                                                        \
+        if (a[i] < r.minVal) r.minVal = a[i];                                   \
+        if (a[i] > r.maxVal) r.maxVal = a[i];                                   \
+    }                                                                           \
+    return r;                                                                   \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+long long find(const typename Ops::T* a, size_t n, typename Ops::T key) {       \
+    const size_t L = Ops::LANES;                                                \
+    typename Ops::V k = Ops::set1(key);                                         \
+    size_t i = 0;                                                               \
+    for (; i + 4 * L <= n; i += 4 * L) {                                        \
+        uint32_t m = Ops::eqMask(Ops::load(a + i), k)                           \
+                   | Ops::eqMask(Ops::load(a + i + L), k) << L                  \
+                   | Ops::eqMask(Ops::load(a + i + 2 * L), k) << (2 * L)        \
+                   | Ops::eqMask(Ops::load(a + i + 3 * L), k) << (3 * L);       \
+        if (m) return (long long)(i + __builtin_ctz(m));                        \
+    }                                                                           \
+    long long rest = scalar::find(a + i, n - i, key);                           \
+    return rest < 0 ? -1 : (long long)i + rest;                                 \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+size_t count(const typename Ops::T* a, size_t n, typename Ops::T key) {         \
+    const size_t L = Ops::LANES;                                                \
+    typename Ops::V k = Ops::set1(key);                                         \
+    size_t total = 0, i = 0;                                                    \
+    for (; i + 4 * L <= n; i += 4 * L) {                                        \
+        uint32_t m = Ops::eqMask(Ops::load(a + i), k)                           \
+                   | Ops::eqMask(Ops::load(a + i + L), k) << L                  \
+                   | Ops::eqMask(Ops::load(a + i + 2 * L), k) << (2 * L)        \
+                   | Ops::eqMask(Ops::load(a + i + 3 * L), k) << (3 * L);       \
+        total += __builtin_popcount(m);                                         \
+    }                                                                           \
+    return total + scalar::count(a + i, n - i, key);                            \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+bool isSorted(const typename Ops::T* a, size_t n) {                             \
+    const size_t L = Ops::LANES;                                                \
+    size_t i = 0;                                                               \
+    for (; i + 2 * L < n; i += 2 * L) {                                         \
+        uint32_t m = Ops::gtMask(Ops::load(a + i), Ops::load(a + i + 1))        \
+                   | Ops::gtMask(Ops::load(a + i + L), Ops::load(a + i + L + 1)); \
+        if (m) return false;                                                    \
+    }                                                                           \
+    return scalar::isSorted(a + i, n - i);                                      \
+}
+
+// ========================================
+// SSE4.2 KERNELS
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("sse4.2,popcnt")
+namespace sse42 {
+
+struct I32Ops {
+    typedef int32_t T;
+    typedef __m128i V;
+    static const size_t LANES = 4;
+    static V load(const T* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static void store(T* p, V v) { _mm_storeu_si128((__m128i*)p, v); }
+    static V set1(T x) { return _mm_set1_epi32(x); }
+    static uint32_t eqMask(V a, V b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    static uint32_t gtMask(V a, V b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(a, b))); }
+    static V vmin(V a, V b) { return _mm_min_epi32(a, b); }
+    static V vmax(V a, V b) { return _mm_max_epi32(a, b); }
+};
+
+struct I64Ops {
+    typedef int64_t T;
+    typedef __m128i V;
+    static const size_t LANES = 2;
+    static V load(const T* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static void store(T* p, V v) { _mm_storeu_si128((__m128i*)p, v); }
+    static V set1(T x) { return _mm_set1_epi64x(x); }
+    static uint32_t eqMask(V a, V b) { return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b))); }
+    static uint32_t gtMask(V a, V b) { return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(a, b))); }
+    static V vmin(V a, V b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b)); }
+    static V vmax(V a, V b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(b, a)); }
+};
+
+struct F32Ops {
+    typedef float T;
+    typedef __m128 V;
+    static const size_t LANES = 4;
+    static V load(const T* p) { return _mm_loadu_ps(p); }
+    static void store(T* p, V v) { _mm_storeu_ps(p, v); }
+    static V set1(T x) { return _mm_set1_ps(x); }
+    static uint32_t eqMask(V a, V b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static uint32_t gtMask(V a, V b) { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+    static V vmin(V a, V b) { return _mm_min_ps(a, b); }
+    static V vmax(V a, V b) { return _mm_max_ps(a, b); }
+};
+
+DEFINE_GENERIC_SIMD_KERNELS
+
+long long sum(const int32_t* a, size_t n) {
+    __m128i acc0 = _mm_setzero_si128(), acc1 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        acc0 = _mm_add_epi64(acc0, _mm_cvtepi32_epi64(v));
+        acc1 = _mm_add_epi64(acc1, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    acc0 = _mm_add_epi64(acc0, acc1);
+    long long total = wrapAdd(_mm_cvtsi128_si64(acc0), _mm_extract_epi64(acc0, 1));
+    return wrapAdd(total, scalar::sum(a + i, n - i));
+}
+
+long long sum(const int64_t* a, size_t n) {
+    __m128i acc0 = _mm_setzero_si128(), acc1 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm_add_epi64(acc0, _mm_loadu_si128((const __m128i*)(a + i)));
+        acc1 = _mm_add_epi64(acc1, _mm_loadu_si128((const __m128i*)(a + i + 2)));
+    }
+    acc0 = _mm_add_epi64(acc0, acc1);
+    long long total = wrapAdd(_mm_cvtsi128_si64(acc0), _mm_extract_epi64(acc0, 1));
+    return wrapAdd(total, scalar::sum(a + i, n - i));
+}
+
+double sum(const float* a, size_t n) {
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 v = _mm_loadu_ps(a + i);
+        acc0 = _mm_add_pd(acc0, _mm_cvtps_pd(v));
+        acc1 = _mm_add_pd(acc1, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+    acc0 = _mm_add_pd(acc0, acc1);
+    double total = _mm_cvtsd_f64(acc0) + _mm_cvtsd_f64(_mm_unpackhi_pd(acc0, acc0));
+    return total + scalar::sum(a + i, n - i);
+}
+
+}  // namespace sse42
+#pragma GCC pop_options
+
+// ========================================
+// AVX2 KERNELS
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+namespace avx2 {
+
+struct I32Ops {
+    typedef int32_t T;
+    typedef __m256i V;
+    static const size_t LANES = 8;
+    static V load(const T* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static void store(T* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+    static V set1(T x) { return _mm256_set1_epi32(x); }
+    static uint32_t eqMask(V a, V b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+    static uint32_t gtMask(V a, V b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b))); }
+    static V vmin(V a, V b) { return _mm256_min_epi32(a, b); }
+    static V vmax(V a, V b) { return _mm256_max_epi32(a, b); }
+};
+
+struct I64Ops {
+    typedef int64_t T;
+    typedef __m256i V;
+    static const size_t LANES = 4;
+    static V load(const T* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static void store(T* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+    static V set1(T x) { return _mm256_set1_epi64x(x); }
+    static uint32_t eqMask(V a, V b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+    static uint32_t gtMask(V a, V b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b))); }
+    static V vmin(V a, V b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    static V vmax(V a, V b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a)); }
+};
+
+struct F32Ops {
+    typedef float T;
+    typedef __m256 V;
+    static const size_t LANES = 8;
+    static V load(const T* p) { return _mm256_loadu_ps(p); }
+    static void store(T* p, V v) { _mm256_storeu_ps(p, v); }
+    static V set1(T x) { return _mm256_set1_ps(x); }
+    static uint32_t eqMask(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    static uint32_t gtMask(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+    static V vmin(V a, V b) { return _mm256_min_ps(a, b); }
+    static V vmax(V a, V b) { return _mm256_max_ps(a, b); }
+};
+
+DEFINE_GENERIC_SIMD_KERNELS
+
+// Horizontal sum of four 64-bit lanes
+inline long long hsum64(__m256i v) {
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    return wrapAdd(_mm_cvtsi128_si64(s), _mm_extract_epi64(s, 1));
+}
+
+long long sum(const int32_t* a, size_t n) {
+    __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+    __m256i acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(a + i + 8));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v0)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v0, 1)));
+        acc2 = _mm256_add_epi64(acc2, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v1)));
+        acc3 = _mm256_add_epi64(acc3, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v1, 1)));
+    }
+    acc0 = _mm256_add_epi64(_mm256_add_epi64(acc0, acc1), _mm256_add_epi64(acc2, acc3));
+    return wrapAdd(hsum64(acc0), scalar::sum(a + i, n - i));
+}
+
+long long sum(const int64_t* a, size_t n) {
+    __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_epi64(acc0, _mm256_loadu_si256((const __m256i*)(a + i)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_loadu_si256((const __m256i*)(a + i + 4)));
+    }
+    return wrapAdd(hsum64(_mm256_add_epi64(acc0, acc1)), scalar::sum(a + i, n - i));
+}
+
+double sum(const float* a, size_t n) {
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(a + i);
+        acc0 = _mm256_add_pd(acc0, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        acc1 = _mm256_add_pd(acc1, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+    __m256d acc = _mm256_add_pd(acc0, acc1);
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    double total = _mm_cvtsd_f64(s) + _mm_cvtsd_f64(_mm_unpackhi_pd(s, s));
+    return total + scalar::sum(a + i, n - i);
+}
+
+}  // namespace avx2
+#pragma GCC pop_options
+
+#undef DEFINE_GENERIC_SIMD_KERNELS
+
+#endif  // SIMD_X86
+
+// ========================================
+// PUBLIC API (RUNTIME DISPATCH)
+// ========================================
+// T may be float or any 4- or 8-byte signed integer (int, long, long long)
+
+template <typename T>
+struct SimdElement {
+    static_assert(is_same<T, float>::value ||
+                  (is_integral<T>::value && is_signed<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)),
+                  "SIMD kernels support float and 32/64-bit signed integers");
+    // The fixed-width type the ISA kernels are written for
+    using type = typename conditional<is_same<T, float>::value, float,
+                 typename conditional<sizeof(T) == 8, int64_t, int32_t>::type>::type;
+};
+
+#if SIMD_X86
+template <typename E> struct SseOps;
+template <> struct SseOps<int32_t> { typedef sse42::I32Ops type; };
+template <> struct SseOps<int64_t> { typedef sse42::I64Ops type; };
+template <> struct SseOps<float> { typedef sse42::F32Ops type; };
+
+template <typename E> struct AvxOps;
+template <> struct AvxOps<int32_t> { typedef avx2::I32Ops type; };
+template <> struct AvxOps<int64_t> { typedef avx2::I64Ops type; };
+template <> struct AvxOps<float> { typedef avx2::F32Ops type; };
+#endif
+
+// Usage: sum = sumArraySimd(arr, n)
+// Example: sumArraySimd(arr, 5) on {1, 2, 3, 4, 5} returns 15 (as long long)
+template <typename T>
+typename SumOf<T>::type sumArraySimd(const T* arr, size_t n) {
+    typedef typename SimdElement<T>::type E;
+    const E* a = reinterpret_cast<const E*>(arr);
+#if SIMD_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::sum(a, n);
+        case SimdLevel::SSE42: return sse42::sum(a, n);
+        default: break;
+    }
+#endif
+    return scalar::sum(a, n);
+}
+
+// Usage: mm = findMinMaxSimd(arr, n) - mm.minVal / mm.maxVal (n must be > 0)
+// Example: findMinMaxSimd(arr, 5) on {3, 1, 4, 1, 5} returns {1, 5}
+template <typename T>
+MinMax<T> findMinMaxSimd(const T* arr, size_t n) {
+    typedef typename SimdElement<T>::type E;
+    const E* a = reinterpret_cast<const E*>(arr);
+    MinMax<E> r;
+#if SIMD_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: r = avx2::minMax<typename AvxOps<E>::type>(a, n); break;
+        case SimdLevel::SSE42: r = sse42::minMax<typename SseOps<E>::type>(a, n); break;
+        default: r = scalar::minMax(a, n); break;
+    }
+#else
+    r = scalar::minMax(a, n);
+#endif
+    return {(T)r.minVal, (T)r.maxVal};
+}
+
+// Usage: index = linearSearchSimd(arr, n, key) - first index of key, or -1
+// Example: linearSearchSimd(arr, 5, 30) on {10, 20, 30, 40, 50} returns 2
+template <typename T>
+long long linearSearchSimd(const T* arr, size_t n, T key) {
+    typedef typename SimdElement<T>::type E;
+    const E* a = reinterpret_cast<const E*>(arr);
+#if SIMD_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::find<typename AvxOps<E>::type>(a, n, (E)key);
+        case SimdLevel::SSE42: return sse42::find<typename SseOps<E>::type>(a, n, (E)key);
+        default: break;
+    }
+#endif
+    return scalar::find(a, n, (E)key);
+}
+
+// Usage: count = countOccurrencesSimd(arr, n, value)
+// Example: countOccurrencesSimd(arr, 5, 30) on {30, 1, 30, 2, 30} returns 3
+template <typename T>
+size_t countOccurrencesSimd(const T* arr, size_t n, T value) {
+    typedef typename SimdElement<T>::type E;
+    const E* a = reinterpret_cast<const E*>(arr);
+#if SIMD_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::count<typename AvxOps<E>::type>(a, n, (E)value);
+        case SimdLevel::SSE42: return sse42::count<typename SseOps<E>::type>(a, n, (E)value);
+        default: break;
+    }
+#endif
+    return scalar::count(a, n, (E)value);
+}
+
+// Usage: sorted = checkSortedSimd(arr, n) - true if non-decreasing
+// Example: checkSortedSimd(arr, 5) on {1, 2, 2, 3, 5} returns true
+template <typename T>
+bool checkSortedSimd(const T* arr, size_t n) {
+    typedef typename SimdElement<T>::type E;
+    const E* a = reinterpret_cast<const E*>(arr);
+#if SIMD_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::isSorted<typename AvxOps<E>::type>(a, n);
+        case SimdLevel::SSE42: return sse42::isSorted<typename SseOps<E>::type>(a, n);
+        default: break;
+    }
+#endif
+    return scalar::isSorted(a, n);
+}
+
+// ========================================
+// BENCHMARK: GB/s PER KERNEL AND ISA
+// ========================================
+// Usage: benchmarkArrayKernels<T>(maxElements)
+// Example: benchmarkArrayKernels<int>(1 << 30) - sizes 1K, 32K, 1M, 32M, 1G
+// elements (the 1G run needs 4 GB of memory for int)
+template <typename T>
+void benchmarkArrayKernels(size_t maxElements) {
+    using Clock = chrono::steady_clock;
+    cout << "Detected SIMD level: " << simdLevelName(detectSimdLevel()) << endl;
+    cout << "elements  kernel       scalar(GB/s)  sse4.2(GB/s)  avx2(GB/s)" << endl;
+
+    vector<T> data(maxElements);
+    for (size_t i = 0; i < maxElements; i++) data[i] = (T)(i % 1000);
+    // Worst case for search/sorted: key absent, array fully sorted
+    vector<T> sorted(data);
+    sort(sorted.begin(), sorted.end());
+
+    const char* names[] = {"sum", "minmax", "search", "count", "sorted"};
+    SimdLevel levels[] = {SimdLevel::SCALAR, SimdLevel::SSE42, SimdLevel::AVX2};
+    long long sink = 0;
+
+    for (size_t n = 1024; n <= maxElements; n *= 32) {
+        // Enough repetitions to stream about 1 GB per measurement
+        size_t reps = max<size_t>(1, ((size_t)1 << 30) / (n * sizeof(T)));
+        for (int k = 0; k < 5; k++) {
+            cout << n << "  " << names[k] << "  ";
+            for (SimdLevel level : levels) {
+                setSimdLevel(level);
+                auto start = Clock::now();
+                for (size_t r = 0; r < reps; r++) {
+                    switch (k) {
+                        case 0: sink += (long long)sumArraySimd(data.data(), n); break;
+                        case 1: sink += (long long)findMinMaxSimd(data.data(), n).maxVal; break;
+                        case 2: sink += linearSearchSimd(data.data(), n, (T)-1); break;
+                        case 3: sink += (long long)countOccurrencesSimd(data.data(), n, (T)7); break;
+                        case 4: sink += checkSortedSimd(sorted.data(), n); break;
+                    }
+                }
+                double secs = chrono::duration<double>(Clock::now() - start).count();
+                cout << (double)reps * n * sizeof(T) / secs / 1e9 << "  ";
+            }
+            cout << endl;
+        }
+    }
+    setSimdLevel(SimdLevel::AVX2);
+    cout << "(checksum " << sink << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== SIMD Array Kernels ===" << endl;
+    cout << "Using: " << simdLevelName(currentSimdLevel()) << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // int arr[] = {10, 20, 30, 40, 50, 30, 70, 80, 90, 30};
+    // size_t n = 10;
+
+    // Sum (64-bit accumulator)
+    // cout << "Sum: " << sumArraySimd(arr, n) << endl;
+
+    // Min and max
+    // MinMax<int> mm = findMinMaxSimd(arr, n);
+    // cout << "Min: " << mm.minVal << ", Max: " << mm.maxVal << endl;
+
+    // Linear search
+    // cout << "Index of 40: " << linearSearchSimd(arr, n, 40) << endl;
+
+    // Count occurrences
+    // cout << "Occurrences of 30: " << countOccurrencesSimd(arr, n, 30) << endl;
+
+    // Check sorted
+    // cout << (checkSortedSimd(arr, n) ? "Sorted" : "Not sorted") << endl;
+
+    // Float and 64-bit arrays use the same calls
+    // float f[] = {1.5f, -2.0f, 3.25f};
+    // cout << "Float sum: " << sumArraySimd(f, 3) << endl;
+
+    // Throughput benchmark
+    // benchmarkArrayKernels<int>(1 << 25);
+
+    return 0;
+}
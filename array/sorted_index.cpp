@@ -0,0 +1,449 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#define SORTED_INDEX_X86 1
+#include <immintrin.h>
+#else
+#define SORTED_INDEX_X86 0
+#endif
+using namespace std;
+
+// ========================================
+// STATIC SORTED-SET INDEX
+// ========================================
+// Concept: binarySearch in core_problems.cpp halves a plain sorted array,
+// so on large arrays every probe after the first few is a cache miss and
+// the branch on arr[mid] < key mispredicts half the time. The structures
+// below rebuild the same sorted keys into layouts whose search path is
+// cache friendly and branch free.
+// - branchlessLowerBound: same array, conditional moves + prefetch
+// - EytzingerIndex: implicit BFS layout (children of k at 2k, 2k+1)
+// - STreeIndex: static B+ tree with 16 keys (one cache line) per node
+// All answer lower_bound: index of the first key >= x, or n if none.
+// The index is built once from a sorted array and is read-only afterwards.
+
+// 64-byte aligned int buffer (one node / prefetch block per cache line)
+class AlignedInts {
+    int* data;
+    size_t count;
+
+public:
+    explicit AlignedInts(size_t n = 0) : data(nullptr), count(n) {
+        if (n > 0) {
+            size_t bytes = (n * sizeof(int) + 63) / 64 * 64;
+            data = static_cast<int*>(aligned_alloc(64, bytes));
+            if (!data) throw bad_alloc();
+        }
+    }
+    ~AlignedInts() { free(data); }
+    AlignedInts(const AlignedInts&) = delete;
+    AlignedInts& operator=(const AlignedInts&) = delete;
+    AlignedInts(AlignedInts&& other) noexcept : data(other.data), count(other.count) {
+        other.data = nullptr;
+        other.count = 0;
+    }
+    AlignedInts& operator=(AlignedInts&& other) noexcept {
+        swap(data, other.data);
+        swap(count, other.count);
+        return *this;
+    }
+
+    int* get() { return data; }
+    const int* get() const { return data; }
+    int& operator[](size_t i) { return data[i]; }
+    const int& operator[](size_t i) const { return data[i]; }
+    size_t size() const { return count; }
+};
+
+bool cpuHasAvx2() {
+#if SORTED_INDEX_X86 && defined(__GNUC__)
+    static const bool has = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    return has;
+#else
+    return false;
+#endif
+}
+
+// ========================================
+// 1. BRANCHLESS BINARY SEARCH
+// ========================================
+// Concept: Shrink a window [base, base + len) by half each step; the
+// comparison picks the new base with a conditional move instead of a
+// branch, and both possible next midpoints are prefetched.
+// Usage: index = branchlessLowerBound(arr, n, x)
+// Example: branchlessLowerBound(arr, 5, 25) on {10, 20, 30, 40, 50} returns 2
+size_t branchlessLowerBound(const int* arr, size_t n, int x) {
+    if (n == 0) return 0;
+    const int* base = arr;
+    size_t len = n;
+    while (len > 1) {
+        size_t half = len / 2;
+        __builtin_prefetch(base + half / 2);
+        __builtin_prefetch(base + half + half / 2);
+        base = (base[half - 1] < x) ? base + half : base;
+        len -= half;
+    }
+    return (base - arr) + (*base < x);
+}
+
+// ========================================
+// 2. EYTZINGER LAYOUT
+// ========================================
+// Concept: Store keys in BFS order of an implicit complete binary tree
+// (root at 1, children of k at 2k and 2k+1). The top of the tree shares a
+// handful of cache lines, and the 16 descendants four levels below k sit
+// in one aligned line at 16k, so they can be prefetched in one request.
+// The tree is padded with INT_MAX to a complete tree of depth D so every
+// search runs exactly D branch-free steps.
+// Usage: EytzingerIndex idx(sortedArr, n); idx.lowerBound(x);
+class EytzingerIndex {
+    AlignedInts tree;  // tree[1 .. 2^depth - 1], tree[0] unused
+    size_t n;
+    int depth;
+
+    void fill(const int* arr, size_t& i, size_t k) {
+        if (k >= tree.size()) return;
+        fill(arr, i, 2 * k);
+        tree[k] = i < n ? arr[i] : INT_MAX;
+        i++;
+        fill(arr, i, 2 * k + 1);
+    }
+
+    // Sorted-array index of tree node k (in-order rank in the complete tree)
+    size_t inorderIndex(size_t k) const {
+        int level = 63 - __builtin_clzll(k);
+        return ((2 * (k - ((size_t)1 << level)) + 1) << (depth - 1 - level)) - 1;
+    }
+
+    // After D steps k is below the leaves; undo the trailing "went right"
+    // steps to reach the last node where the search went left (the answer)
+    static size_t answerNode(size_t k) {
+        return k >> __builtin_ffsll(~(long long)k);
+    }
+
+    size_t finish(size_t k) const {
+        k = answerNode(k);
+        return k == 0 ? n : min(inorderIndex(k), n);
+    }
+
+public:
+    EytzingerIndex(const int* sortedArr, size_t count) : n(count), depth(0) {
+        while (((size_t)1 << depth) - 1 < n) depth++;
+        if (depth == 0) depth = 1;
+        tree = AlignedInts((size_t)1 << depth);
+        tree[0] = INT_MIN;
+        size_t i = 0;
+        fill(sortedArr, i, 1);
+    }
+
+    size_t size() const { return n; }
+    size_t memoryBytes() const { return tree.size() * sizeof(int); }
+
+    // Usage: index = idx.lowerBound(x) - first index with key >= x, or n
+    size_t lowerBound(int x) const {
+        const int* t = tree.get();
+        size_t k = 1;
+        for (int l = 0; l < depth; l++) {
+            __builtin_prefetch(t + k * 16);
+            k = 2 * k + (t[k] < x);
+        }
+        return finish(k);
+    }
+
+    // Usage: index = idx.search(key) - index of key or -1 (like binarySearch)
+    long long search(int key) const {
+        size_t k = 1;
+        for (int l = 0; l < depth; l++) k = 2 * k + (tree[k] < key);
+        k = answerNode(k);
+        if (k == 0 || tree[k] != key) return -1;
+        size_t i = inorderIndex(k);
+        return i < n ? (long long)i : -1;
+    }
+
+    // Usage: idx.lowerBoundBatch(keys, q, out) - out[i] = lowerBound(keys[i])
+    // Runs GROUP searches in lockstep so their cache misses overlap.
+    void lowerBoundBatch(const int* keys, size_t q, size_t* out) const {
+        const int GROUP = 32;
+        const int* t = tree.get();
+        size_t k[GROUP];
+        for (size_t start = 0; start < q; start += GROUP) {
+            int g = (int)min<size_t>(GROUP, q - start);
+            const int* x = keys + start;
+            for (int j = 0; j < g; j++) k[j] = 1;
+            for (int l = 0; l < depth; l++) {
+                for (int j = 0; j < g; j++) {
+                    __builtin_prefetch(t + k[j] * 16);
+                    k[j] = 2 * k[j] + (t[k[j]] < x[j]);
+                }
+            }
+            for (int j = 0; j < g; j++) out[start + j] = finish(k[j]);
+        }
+    }
+};
+
+// ========================================
+// 3. S-TREE (STATIC B+ TREE)
+// ========================================
+// Concept: Layer 0 is the sorted keys themselves, padded with INT_MAX to
+// a multiple of B = 16. Each layer above holds, for every node, the first
+// key of its children 1..B, so a node of B keys routes to B + 1 children.
+// Layers are stored leaf-first in one aligned buffer; node search is a
+// 16-wide compare + popcount (AVX2 when available).
+// Usage: STreeIndex idx(sortedArr, n); idx.lowerBound(x);
+class STreeIndex {
+    static const size_t B = 16;
+
+    AlignedInts tree;
+    vector<size_t> offsets;  // offsets[h] = first key of layer h
+    size_t n;
+    int height;
+    bool useAvx2;
+
+    static size_t blocks(size_t keys) { return (keys + B - 1) / B; }
+    static size_t parentKeys(size_t keys) { return (blocks(keys) + B) / (B + 1) * B; }
+
+    static size_t rankScalar(int x, const int* node) {
+        size_t r = 0;
+        for (size_t j = 0; j < B; j++) r += node[j] < x;
+        return r;
+    }
+
+    size_t lowerBoundScalar(int x) const {
+        const int* t = tree.get();
+        size_t k = 0;
+        for (int h = height - 1; h > 0; h--) {
+            size_t r = rankScalar(x, t + offsets[h] + k);
+            k = k * (B + 1) + r * B;
+        }
+        return min(k + rankScalar(x, t + k), n);
+    }
+
+#if SORTED_INDEX_X86
+    __attribute__((target("avx2,popcnt")))
+    static size_t rankAvx2(__m256i xv, const int* node) {
+        __m256i lo = _mm256_load_si256((const __m256i*)node);
+        __m256i hi = _mm256_load_si256((const __m256i*)(node + 8));
+        unsigned m = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(xv, lo)))
+                   | _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(xv, hi))) << 8;
+        return __builtin_popcount(m);
+    }
+
+    __attribute__((target("avx2,popcnt")))
+    size_t lowerBoundAvx2(int x) const {
+        const int* t = tree.get();
+        __m256i xv = _mm256_set1_epi32(x);
+        size_t k = 0;
+        for (int h = height - 1; h > 0; h--) {
+            size_t r = rankAvx2(xv, t + offsets[h] + k);
+            k = k * (B + 1) + r * B;
+        }
+        return min(k + rankAvx2(xv, t + k), n);
+    }
+
+    __attribute__((target("avx2,popcnt")))
+    void batchAvx2(const int* keys, size_t q, size_t* out) const {
+        const int GROUP = 16;
+        const int* t = tree.get();
+        size_t k[GROUP];
+        for (size_t start = 0; start < q; start += GROUP) {
+            int g = (int)min<size_t>(GROUP, q - start);
+            const int* x = keys + start;
+            for (int j = 0; j < g; j++) k[j] = 0;
+            for (int h = height - 1; h > 0; h--) {
+                for (int j = 0; j < g; j++) {
+                    size_t r = rankAvx2(_mm256_set1_epi32(x[j]), t + offsets[h] + k[j]);
+                    k[j] = k[j] * (B + 1) + r * B;
+                    __builtin_prefetch(t + offsets[h - 1] + k[j]);
+                }
+            }
+            for (int j = 0; j < g; j++) {
+                out[start + j] = min(k[j] + rankAvx2(_mm256_set1_epi32(x[j]), t + k[j]), n);
+            }
+        }
+    }
+#endif
+
+public:
+    STreeIndex(const int* sortedArr, size_t count) : n(count), height(1), useAvx2(cpuHasAvx2()) {
+        // Layer sizes, leaf layer first
+        offsets.push_back(0);
+        size_t keys = max<size_t>(n, 1);
+        offsets.push_back(blocks(keys) * B);
+        while (keys > B) {
+            keys = parentKeys(keys);
+            offsets.push_back(offsets.back() + blocks(keys) * B);
+            height++;
+        }
+
+        tree = AlignedInts(offsets.back());
+        if (n > 0) memcpy(tree.get(), sortedArr, n * sizeof(int));
+        for (size_t i = n; i < offsets[1]; i++) tree[i] = INT_MAX;
+
+        for (int h = 1; h < height; h++) {
+            for (size_t i = 0; i < offsets[h + 1] - offsets[h]; i++) {
+                // Key j of node p is the first leaf key of child j + 1
+                size_t p = i / B, j = i % B;
+                size_t k = p * (B + 1) + j + 1;
+                for (int l = 1; l < h; l++) k *= (B + 1);
+                tree[offsets[h] + i] = k * B < n ? tree[k * B] : INT_MAX;
+            }
+        }
+    }
+
+    size_t size() const { return n; }
+    size_t memoryBytes() const { return tree.size() * sizeof(int); }
+
+    // Usage: index = idx.lowerBound(x) - first index with key >= x, or n
+    size_t lowerBound(int x) const {
+#if SORTED_INDEX_X86
+        if (useAvx2) return lowerBoundAvx2(x);
+#endif
+        return lowerBoundScalar(x);
+    }
+
+    // Usage: index = idx.search(key) - index of key or -1 (like binarySearch)
+    long long search(int key) const {
+        size_t i = lowerBound(key);
+        return i < n && tree[i] == key ? (long long)i : -1;
+    }
+
+    // Usage: idx.lowerBoundBatch(keys, q, out) - out[i] = lowerBound(keys[i])
+    void lowerBoundBatch(const int* keys, size_t q, size_t* out) const {
+#if SORTED_INDEX_X86
+        if (useAvx2) {
+            batchAvx2(keys, q, out);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < q; i++) out[i] = lowerBoundScalar(keys[i]);
+    }
+};
+
+// ========================================
+// BASELINE (copy of core_problems.cpp)
+// ========================================
+
+int binarySearch(int arr[], int n, int key) {
+    int low = 0, high = n - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (arr[mid] == key) {
+            return mid;
+        } else if (arr[mid] < key) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+// ========================================
+// BENCHMARK: NS PER QUERY, L1 TO DRAM
+// ========================================
+// Usage: benchmarkSortedIndex(maxKeys, queries)
+// Example: benchmarkSortedIndex(100000000, 1000000) - sizes 1K .. 100M keys
+void benchmarkSortedIndex(size_t maxKeys, size_t queries) {
+    using Clock = chrono::steady_clock;
+    mt19937 rng(42);
+    cout << "AVX2 node search: " << (cpuHasAvx2() ? "yes" : "no") << endl;
+    cout << "keys  binarySearch  std::lower_bound  branchless  eytzinger  eytz-batch  s-tree  s-tree-batch (ns/query)" << endl;
+
+    vector<size_t> sizes;
+    for (size_t n = 1024; n < maxKeys; n *= 8) sizes.push_back(n);
+    sizes.push_back(maxKeys);
+
+    for (size_t n : sizes) {
+        // Even keys 0, 2, 4, ...; queries hit about half the time
+        vector<int> keys(n);
+        for (size_t i = 0; i < n; i++) keys[i] = (int)(2 * i);
+        vector<int> q(queries);
+        for (auto& x : q) x = (int)(rng() % (2 * n + 1));
+        vector<size_t> out(queries);
+
+        EytzingerIndex eytz(keys.data(), n);
+        STreeIndex stree(keys.data(), n);
+
+        size_t checksum = 0;
+        auto timeIt = [&](auto&& body) {
+            auto start = Clock::now();
+            body();
+            return chrono::duration<double, nano>(Clock::now() - start).count() / queries;
+        };
+
+        double tBin = timeIt([&] {
+            for (int x : q) checksum += binarySearch(keys.data(), (int)n, x) + 1;
+        });
+        double tStd = timeIt([&] {
+            for (int x : q) checksum += lower_bound(keys.begin(), keys.end(), x) - keys.begin();
+        });
+        double tBranchless = timeIt([&] {
+            for (int x : q) checksum += branchlessLowerBound(keys.data(), n, x);
+        });
+        double tEytz = timeIt([&] {
+            for (int x : q) checksum += eytz.lowerBound(x);
+        });
+        double tEytzBatch = timeIt([&] {
+            eytz.lowerBoundBatch(q.data(), queries, out.data());
+        });
+        double tTree = timeIt([&] {
+            for (int x : q) checksum += stree.lowerBound(x);
+        });
+        double tTreeBatch = timeIt([&] {
+            stree.lowerBoundBatch(q.data(), queries, out.data());
+        });
+        checksum += out[queries / 2];
+
+        cout << n << "  " << tBin << "  " << tStd << "  " << tBranchless << "  " << tEytz
+             << "  " << tEytzBatch << "  " << tTree << "  " << tTreeBatch
+             << "   (memory: eytzinger " << eytz.memoryBytes() / 1024 << " KB, s-tree "
+             << stree.memoryBytes() / 1024 << " KB, checksum " << checksum << ")" << endl;
+    }
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Static Sorted-Set Index ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // int arr[] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+    // size_t n = 9;
+
+    // Branchless search on the plain array
+    // cout << "lower_bound(35): " << branchlessLowerBound(arr, n, 35) << endl;
+
+    // Eytzinger layout
+    // EytzingerIndex eytz(arr, n);
+    // cout << "lower_bound(35): " << eytz.lowerBound(35) << endl;
+    // cout << "Index of 70: " << eytz.search(70) << endl;
+
+    // S-tree layout
+    // STreeIndex stree(arr, n);
+    // cout << "lower_bound(35): " << stree.lowerBound(35) << endl;
+    // cout << "Index of 70: " << stree.search(70) << endl;
+
+    // Batched lookups
+    // int keys[] = {5, 35, 90, 100};
+    // size_t results[4];
+    // stree.lowerBoundBatch(keys, 4, results);
+    // for (size_t r : results) cout << r << " ";
+    // cout << endl;
+
+    // Benchmark from L1-sized to DRAM-sized arrays
+    // benchmarkSortedIndex(100000000, 1000000);
+
+    return 0;
+}
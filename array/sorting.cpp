@@ -0,0 +1,613 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#if defined(__x86_64__) || defined(__i386__)
+#define SORT_X86 1
+#include <immintrin.h>
+#else
+#define SORT_X86 0
+#endif
+#ifdef SORT_WITH_PAR_STL
+#include <execution>
+#endif
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread sorting.cpp
+// With std::execution::par in the benchmark (libstdc++ uses TBB):
+//        g++ -std=c++17 -O2 -pthread -DSORT_WITH_PAR_STL sorting.cpp -ltbb
+
+// ========================================
+// SORTING MODULE
+// ========================================
+// Concept: sortArray in core_problems.cpp is one std::sort call on one
+// thread. For 10^8+ keys this file offers:
+// - radixSort: LSD radix sort on 8-bit digits for integer / float keys
+// - networkSort16 + mergeSort: branch-free sorting network for 16-element
+//   base cases under a bottom-up merge sort (any type with operator<);
+//   int32 blocks are sorted in SSE4.1 / AVX2 registers, picked at runtime
+// - parallelSort: per-thread chunk sorts followed by a parallel multiway
+//   merge (PSRS splitters) on a ThreadPool
+// Every function also sorts KeyValue<K, V> records by key.
+
+// Key-value record; ordered (and radix sorted) by key only
+template <typename K, typename V>
+struct KeyValue {
+    K key;
+    V value;
+
+    bool operator<(const KeyValue& other) const { return key < other.key; }
+};
+
+// ========================================
+// THREAD POOL
+// ========================================
+// Usage: ThreadPool pool(4); pool.parallelFor(n, [](size_t i) { ... });
+class ThreadPool {
+    vector<thread> workers;
+    queue<function<void()>> tasks;
+    mutex m;
+    condition_variable taskReady;
+    condition_variable allDone;
+    size_t pending;
+    bool stopping;
+
+    void workerLoop() {
+        while (true) {
+            function<void()> task;
+            {
+                unique_lock<mutex> lock(m);
+                taskReady.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) return;
+                task = move(tasks.front());
+                tasks.pop();
+            }
+            task();
+            lock_guard<mutex> lock(m);
+            if (--pending == 0) allDone.notify_all();
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t threads = thread::hardware_concurrency()) : pending(0), stopping(false) {
+        if (threads == 0) threads = 1;
+        for (size_t i = 0; i < threads; i++) workers.emplace_back([this] { workerLoop(); });
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        taskReady.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return workers.size(); }
+
+    void submit(function<void()> task) {
+        {
+            lock_guard<mutex> lock(m);
+            tasks.push(move(task));
+            pending++;
+        }
+        taskReady.notify_one();
+    }
+
+    // Blocks until every submitted task has finished
+    void wait() {
+        unique_lock<mutex> lock(m);
+        allDone.wait(lock, [this] { return pending == 0; });
+    }
+
+    // Runs fn(0) .. fn(count - 1) on the pool and waits for all of them
+    void parallelFor(size_t count, const function<void(size_t)>& fn) {
+        for (size_t i = 0; i < count; i++) submit([&fn, i] { fn(i); });
+        wait();
+    }
+};
+
+// ========================================
+// 1. RADIX SORT
+// ========================================
+// Concept: Map each key to an unsigned integer with the same ordering,
+// then do one stable counting-sort pass per byte, least significant first.
+// All byte histograms are built in a single read of the input, and passes
+// where every key has the same byte are skipped (e.g. small-range data).
+// Time: O(n * bytes), Space: O(n) scratch
+
+template <typename T>
+struct RadixKey {
+    static_assert(is_arithmetic<T>::value, "radix keys must be integers or floating point");
+    typedef typename conditional<sizeof(T) == 8, uint64_t, uint32_t>::type U;
+    static_assert(sizeof(T) == sizeof(U), "radix keys must be 4 or 8 bytes");
+    static const int BITS = sizeof(U) * 8;
+
+    static U encode(T x) {
+        U u;
+        memcpy(&u, &x, sizeof(U));
+        if constexpr (is_floating_point<T>::value) {
+            // Negative floats: flip all bits; positive: flip the sign bit
+            U mask = (U)(0 - (u >> (BITS - 1))) | ((U)1 << (BITS - 1));
+            return u ^ mask;
+        }
+        if constexpr (is_signed<T>::value) return u ^ ((U)1 << (BITS - 1));
+        return u;
+    }
+};
+
+template <typename T>
+struct SortKeyOf {
+    typedef T type;
+    static const T& get(const T& x) { return x; }
+};
+
+template <typename K, typename V>
+struct SortKeyOf<KeyValue<K, V>> {
+    typedef K type;
+    static const K& get(const KeyValue<K, V>& x) { return x.key; }
+};
+
+template <typename T>
+void insertionSort(T* a, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        T x = move(a[i]);
+        size_t j = i;
+        while (j > 0 && x < a[j - 1]) {
+            a[j] = move(a[j - 1]);
+            j--;
+        }
+        a[j] = move(x);
+    }
+}
+
+// Usage: radixSort(arr, n) - arr of int, unsigned, long long, float, double
+//        or KeyValue<K, V> with such a K; stable
+// Example: radixSort(arr, 5) on {3, -1, 2, -5, 0} gives {-5, -1, 0, 2, 3}
+template <typename T>
+void radixSort(T* a, size_t n) {
+    typedef SortKeyOf<T> KeyOf;
+    typedef RadixKey<typename KeyOf::type> Radix;
+    typedef typename Radix::U U;
+    const int PASSES = sizeof(U);
+
+    if (n < 64) {
+        insertionSort(a, n);
+        return;
+    }
+
+    vector<size_t> hist(PASSES * 256, 0);
+    for (size_t i = 0; i < n; i++) {
+        U k = Radix::encode(KeyOf::get(a[i]));
+        for (int p = 0; p < PASSES; p++) hist[p * 256 + ((k >> (8 * p)) & 0xFF)]++;
+    }
+
+    vector<T> scratch(n);
+    T* src = a;
+    T* dst = scratch.data();
+    U firstKey = Radix::encode(KeyOf::get(a[0]));
+    for (int p = 0; p < PASSES; p++) {
+        size_t* count = &hist[p * 256];
+        // Every key has the same digit here: this pass would be a copy
+        if (count[(firstKey >> (8 * p)) & 0xFF] == n) continue;
+
+        size_t offset = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t c = count[d];
+            count[d] = offset;
+            offset += c;
+        }
+        for (size_t i = 0; i < n; i++) {
+            U k = Radix::encode(KeyOf::get(src[i]));
+            dst[count[(k >> (8 * p)) & 0xFF]++] = move(src[i]);
+        }
+        swap(src, dst);
+    }
+    if (src != a) move(src, src + n, a);
+}
+
+// ========================================
+// 2. SORTING NETWORK + MERGE SORT
+// ========================================
+// Concept: A sorting network is a fixed sequence of compare-exchange
+// steps, so it has no data-dependent branches. networkSort16 is a bitonic
+// network (10 stages of 8 compare-exchanges). The generic version is
+// scalar compare / cmov pairs. For int32 the 16 keys sit in four SSE
+// or two AVX2 registers instead: each stage is one min and one max per
+// register pair. Partners in other lanes come from a shuffle, and a
+// constant blend keeps min or max per lane. The instruction set is picked
+// at runtime; setSimdLevel caps it.
+
+template <typename T>
+inline void compareExchange(T& a, T& b) {
+    bool swapNeeded = b < a;
+    T lo = swapNeeded ? b : a;
+    T hi = swapNeeded ? a : b;
+    a = lo;
+    b = hi;
+}
+
+// Usage: networkSort16(block) - sorts exactly 16 elements in place
+template <typename T>
+void networkSort16(T* a) {
+    for (int k = 2; k <= 16; k *= 2) {
+        for (int j = k / 2; j > 0; j /= 2) {
+            for (int i = 0; i < 16; i++) {
+                int l = i ^ j;
+                if (l > i) {
+                    if ((i & k) == 0) compareExchange(a[i], a[l]);
+                    else compareExchange(a[l], a[i]);
+                }
+            }
+        }
+    }
+}
+
+enum class SimdLevel { SCALAR = 0, SSE41 = 1, AVX2 = 2 };
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE41: return "sse4.1";
+        default: return "scalar";
+    }
+}
+
+SimdLevel detectSimdLevel() {
+#if SORT_X86 && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+SimdLevel simdLevelCap = SimdLevel::AVX2;
+
+// Usage: setSimdLevel(SimdLevel::SCALAR) - sort blocks with the generic network
+void setSimdLevel(SimdLevel level) {
+    simdLevelCap = level;
+}
+
+SimdLevel currentSimdLevel() {
+    static const SimdLevel detected = detectSimdLevel();
+    return min(detected, simdLevelCap);
+}
+
+// Bit t set when lane t of the register holding keys BASE.. keeps the max
+// in stage (K, J): the lower key of a pair takes the min in ascending
+// (i & K == 0) runs and the max in descending ones
+constexpr int networkMaxLanes(int base, int lanes, int k, int j) {
+    int mask = 0;
+    for (int t = 0; t < lanes; t++) {
+        int i = base + t;
+        bool lower = (i & j) == 0, descending = (i & k) != 0;
+        if (lower == descending) mask |= 1 << t;
+    }
+    return mask;
+}
+
+#if SORT_X86
+// ========================================
+// SSE4.1 NETWORK: 4 registers of 4 keys
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+namespace sse41 {
+
+// Pairs inside a register (J = 1, 2)
+template <int K, int J, int BASE>
+inline __m128i inLanes(__m128i v) {
+    constexpr int m = networkMaxLanes(BASE, 4, K, J);
+    constexpr int words = (m & 1 ? 0x03 : 0) | (m & 2 ? 0x0C : 0) | (m & 4 ? 0x30 : 0) | (m & 8 ? 0xC0 : 0);
+    __m128i p = _mm_shuffle_epi32(v, J == 1 ? 0xB1 : 0x4E);
+    return _mm_blend_epi16(_mm_min_epi32(v, p), _mm_max_epi32(v, p), words);
+}
+
+template <int K, int J>
+inline void stage(__m128i* v) {
+    if constexpr (J >= 4) {
+        // Pairs across registers r and r + J / 4; one direction per register
+        for (int r = 0; r < 4; r++) {
+            if (r & (J / 4)) continue;
+            int q = r + J / 4;
+            __m128i lo = _mm_min_epi32(v[r], v[q]), hi = _mm_max_epi32(v[r], v[q]);
+            bool descending = (r * 4) & K;
+            v[r] = descending ? hi : lo;
+            v[q] = descending ? lo : hi;
+        }
+    } else {
+        v[0] = inLanes<K, J, 0>(v[0]);
+        v[1] = inLanes<K, J, 4>(v[1]);
+        v[2] = inLanes<K, J, 8>(v[2]);
+        v[3] = inLanes<K, J, 12>(v[3]);
+    }
+}
+
+void networkSort16(int32_t* a) {
+    __m128i v[4];
+    for (int r = 0; r < 4; r++) v[r] = _mm_loadu_si128((const __m128i*)(a + 4 * r));
+    stage<2, 1>(v);
+    stage<4, 2>(v); stage<4, 1>(v);
+    stage<8, 4>(v); stage<8, 2>(v); stage<8, 1>(v);
+    stage<16, 8>(v); stage<16, 4>(v); stage<16, 2>(v); stage<16, 1>(v);
+    for (int r = 0; r < 4; r++) _mm_storeu_si128((__m128i*)(a + 4 * r), v[r]);
+}
+
+}  // namespace sse41
+#pragma GCC pop_options
+
+// ========================================
+// AVX2 NETWORK: 2 registers of 8 keys
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+
+// Pairs inside a register (J = 1, 2, 4)
+template <int K, int J, int BASE>
+inline __m256i inLanes(__m256i v) {
+    __m256i p;
+    if constexpr (J == 4) p = _mm256_permute4x64_epi64(v, 0x4E);
+    else p = _mm256_shuffle_epi32(v, J == 1 ? 0xB1 : 0x4E);
+    return _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), networkMaxLanes(BASE, 8, K, J));
+}
+
+template <int K, int J>
+inline void stage(__m256i& a, __m256i& b) {
+    if constexpr (J == 8) {
+        // Only in the last merge (K = 16), which is ascending throughout
+        __m256i lo = _mm256_min_epi32(a, b);
+        b = _mm256_max_epi32(a, b);
+        a = lo;
+    } else {
+        a = inLanes<K, J, 0>(a);
+        b = inLanes<K, J, 8>(b);
+    }
+}
+
+void networkSort16(int32_t* p) {
+    __m256i a = _mm256_loadu_si256((const __m256i*)p);
+    __m256i b = _mm256_loadu_si256((const __m256i*)(p + 8));
+    stage<2, 1>(a, b);
+    stage<4, 2>(a, b); stage<4, 1>(a, b);
+    stage<8, 4>(a, b); stage<8, 2>(a, b); stage<8, 1>(a, b);
+    stage<16, 8>(a, b); stage<16, 4>(a, b); stage<16, 2>(a, b); stage<16, 1>(a, b);
+    _mm256_storeu_si256((__m256i*)p, a);
+    _mm256_storeu_si256((__m256i*)(p + 8), b);
+}
+
+}  // namespace avx2
+#pragma GCC pop_options
+#endif
+
+// int32 blocks: same network, in vector registers when the CPU has them
+inline void networkSort16(int32_t* a) {
+#if SORT_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: avx2::networkSort16(a); return;
+        case SimdLevel::SSE41: sse41::networkSort16(a); return;
+        default: break;
+    }
+#endif
+    networkSort16<int32_t>(a);
+}
+
+// Usage: mergeSort(arr, n) - not stable; works for any T with operator<
+// Sorts 16-element blocks with the network, then merges bottom-up,
+// ping-ponging between arr and one scratch buffer.
+template <typename T>
+void mergeSort(T* a, size_t n) {
+    const size_t BLOCK = 16;
+    size_t i = 0;
+    for (; i + BLOCK <= n; i += BLOCK) networkSort16(a + i);
+    insertionSort(a + i, n - i);
+    if (n <= BLOCK) return;
+
+    vector<T> scratch(n);
+    T* src = a;
+    T* dst = scratch.data();
+    for (size_t width = BLOCK; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            size_t mid = min(lo + width, n), hi = min(lo + 2 * width, n);
+            merge(make_move_iterator(src + lo), make_move_iterator(src + mid),
+                  make_move_iterator(src + mid), make_move_iterator(src + hi), dst + lo);
+        }
+        swap(src, dst);
+    }
+    if (src != a) move(src, src + n, a);
+}
+
+// ========================================
+// 3. PARALLEL MULTIWAY MERGE SORT
+// ========================================
+// Concept (parallel sorting by regular sampling):
+// 1. Split into P chunks and sort each on its own thread (radixSort for
+//    radix-sortable keys, mergeSort otherwise)
+// 2. Take P regular samples from every chunk, sort them, and pick P - 1
+//    splitters; cut every chunk at the splitters with lower_bound
+// 3. Thread j merges piece j of every chunk (a P-way heap merge) into its
+//    own disjoint range of the output, then the result is copied back
+// Time: O(n log n / P + P^2 log P), Space: O(n)
+
+template <typename T>
+struct IsRadixSortable {
+    static const bool value = is_arithmetic<typename SortKeyOf<T>::type>::value &&
+                              (sizeof(typename SortKeyOf<T>::type) == 4 ||
+                               sizeof(typename SortKeyOf<T>::type) == 8);
+};
+
+template <typename T>
+void sortChunk(T* a, size_t n) {
+    if constexpr (IsRadixSortable<T>::value) radixSort(a, n);
+    else mergeSort(a, n);
+}
+
+// Merges the runs [runs[i].first, runs[i].second) into out
+template <typename T>
+void multiwayMerge(vector<pair<T*, T*>>& runs, T* out) {
+    runs.erase(remove_if(runs.begin(), runs.end(),
+                         [](const pair<T*, T*>& r) { return r.first == r.second; }),
+               runs.end());
+    // Min-heap on the head element of each run
+    auto later = [](const pair<T*, T*>& x, const pair<T*, T*>& y) { return *y.first < *x.first; };
+    make_heap(runs.begin(), runs.end(), later);
+    while (runs.size() > 1) {
+        pop_heap(runs.begin(), runs.end(), later);
+        pair<T*, T*>& r = runs.back();
+        *out++ = move(*r.first++);
+        if (r.first == r.second) runs.pop_back();
+        else push_heap(runs.begin(), runs.end(), later);
+    }
+    if (!runs.empty()) move(runs[0].first, runs[0].second, out);
+}
+
+// Usage: parallelSort(arr, n, pool)
+// Example: ThreadPool pool; parallelSort(arr, n, pool);
+template <typename T>
+void parallelSort(T* a, size_t n, ThreadPool& pool) {
+    size_t P = pool.size();
+    if (P == 1 || n < (1 << 16)) {
+        sortChunk(a, n);
+        return;
+    }
+
+    vector<size_t> bound(P + 1);
+    for (size_t i = 0; i <= P; i++) bound[i] = n * i / P;
+    pool.parallelFor(P, [&](size_t i) { sortChunk(a + bound[i], bound[i + 1] - bound[i]); });
+
+    vector<T> samples;
+    for (size_t i = 0; i < P; i++) {
+        size_t len = bound[i + 1] - bound[i];
+        for (size_t s = 0; s < P; s++) samples.push_back(a[bound[i] + len * s / P]);
+    }
+    sort(samples.begin(), samples.end());
+    vector<T> splitters;
+    for (size_t j = 1; j < P; j++) splitters.push_back(samples[j * P + P / 2]);
+
+    // cut[i][j] = start of piece j in chunk i
+    vector<vector<T*>> cut(P, vector<T*>(P + 1));
+    for (size_t i = 0; i < P; i++) {
+        cut[i][0] = a + bound[i];
+        cut[i][P] = a + bound[i + 1];
+        for (size_t j = 1; j < P; j++) {
+            cut[i][j] = lower_bound(cut[i][j - 1], cut[i][P], splitters[j - 1]);
+        }
+    }
+    vector<size_t> outStart(P + 1, 0);
+    for (size_t j = 0; j < P; j++) {
+        size_t pieceSize = 0;
+        for (size_t i = 0; i < P; i++) pieceSize += cut[i][j + 1] - cut[i][j];
+        outStart[j + 1] = outStart[j] + pieceSize;
+    }
+
+    vector<T> out(n);
+    pool.parallelFor(P, [&](size_t j) {
+        vector<pair<T*, T*>> runs;
+        for (size_t i = 0; i < P; i++) runs.push_back({cut[i][j], cut[i][j + 1]});
+        multiwayMerge(runs, out.data() + outStart[j]);
+    });
+    pool.parallelFor(P, [&](size_t j) {
+        move(out.begin() + bound[j], out.begin() + bound[j + 1], a + bound[j]);
+    });
+}
+
+// ========================================
+// BENCHMARK
+// ========================================
+// Usage: benchmarkSorting(maxN)
+// Example: benchmarkSorting(100000000) - 1M, 10M, 100M elements
+
+template <typename T>
+void benchmarkSortType(const char* label, const vector<T>& input, ThreadPool& pool) {
+    using Clock = chrono::steady_clock;
+    auto run = [&](const char* name, auto&& sorter) {
+        vector<T> v(input);
+        auto start = Clock::now();
+        sorter(v);
+        double ms = chrono::duration<double, milli>(Clock::now() - start).count();
+        bool ok = is_sorted(v.begin(), v.end());
+        cout << "  " << label << "  " << name << ": " << ms << " ms ("
+             << input.size() / ms / 1000.0 << " M/s)" << (ok ? "" : "  NOT SORTED") << endl;
+    };
+    run("std::sort", [](vector<T>& v) { sort(v.begin(), v.end()); });
+#ifdef SORT_WITH_PAR_STL
+    run("std::sort(par)", [](vector<T>& v) { sort(execution::par, v.begin(), v.end()); });
+#endif
+    run("radixSort", [](vector<T>& v) { radixSort(v.data(), v.size()); });
+    run("mergeSort", [](vector<T>& v) { mergeSort(v.data(), v.size()); });
+    run("parallelSort", [&](vector<T>& v) { parallelSort(v.data(), v.size(), pool); });
+}
+
+void benchmarkSorting(size_t maxN) {
+    ThreadPool pool;
+    mt19937_64 rng(7);
+    cout << "Threads: " << pool.size() << endl;
+    for (size_t n = 1000000; n <= maxN; n *= 10) {
+        cout << "n = " << n << endl;
+        vector<int> i32(n);
+        for (auto& x : i32) x = (int)rng();
+        benchmarkSortType("int32", i32, pool);
+
+        vector<long long> i64(n);
+        for (auto& x : i64) x = (long long)rng();
+        benchmarkSortType("int64", i64, pool);
+
+        vector<KeyValue<uint32_t, uint32_t>> kv(n);
+        for (size_t i = 0; i < n; i++) kv[i] = {(uint32_t)rng(), (uint32_t)i};
+        benchmarkSortType("kv32", kv, pool);
+    }
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Sorting Module ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // int arr[] = {64, -34, 25, 12, 22, -11, 90, 0};
+    // size_t n = 8;
+
+    // LSD radix sort (integers and floats)
+    // radixSort(arr, n);
+    // for (size_t i = 0; i < n; i++) cout << arr[i] << " ";
+    // cout << endl;
+
+    // Merge sort with sorting-network base case
+    // mergeSort(arr, n);
+
+    // Parallel sort on a thread pool
+    // ThreadPool pool;
+    // vector<int> big(10000000);
+    // for (auto& x : big) x = rand();
+    // parallelSort(big.data(), big.size(), pool);
+
+    // Key-value pairs (sorted by key, value carried along)
+    // KeyValue<int, int> kv[] = {{3, 30}, {1, 10}, {2, 20}};
+    // radixSort(kv, 3);
+    // for (auto& p : kv) cout << p.key << ":" << p.value << " ";
+    // cout << endl;
+
+    // Benchmark against std::sort
+    // benchmarkSorting(100000000);
+
+    return 0;
+}
@@ -0,0 +1,359 @@
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <climits>
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread streaming.cpp
+
+// ========================================
+// STREAMING ARRAY ALGORITHMS
+// ========================================
+// Concept: The versions in advanced_problems.cpp need the whole int arr[]
+// in memory. Here each algorithm is a small state object:
+// - feed(span): consume the next chunk, in order
+// - merge(right): combine with the state of the chunk that follows this
+//   one, so chunks can be processed independently (e.g. on threads)
+// - result(): the answer for everything fed / merged so far
+// States use O(1) memory unless noted, and 64-bit arithmetic throughout.
+
+// Read-only view of a contiguous chunk (std::span is C++20)
+template <typename T>
+struct Span {
+    const T* ptr;
+    size_t len;
+
+    Span(const T* p, size_t n) : ptr(p), len(n) {}
+    Span(const vector<T>& v) : ptr(v.data()), len(v.size()) {}
+    template <size_t N>
+    Span(const T (&arr)[N]) : ptr(arr), len(N) {}
+
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + len; }
+    size_t size() const { return len; }
+};
+
+// ========================================
+// 1. KADANE'S ALGORITHM (mergeable)
+// ========================================
+// Concept: A segment is summarized by (total, best prefix, best suffix,
+// best subarray). The best subarray of A+B is inside A, inside B, or
+// A's best suffix followed by B's best prefix.
+// Usage: KadaneState s; s.feed(chunk1); s.feed(chunk2); s.result();
+// Example: {-2, 1, -3, 4} then {-1, 2, 1, -5, 4} gives 6
+struct KadaneState {
+    long long total = 0;
+    long long bestPrefix = LLONG_MIN;
+    long long bestSuffix = LLONG_MIN;
+    long long best = LLONG_MIN;
+    size_t count = 0;
+
+    void feed(Span<int> chunk) {
+        for (int v : chunk) {
+            long long x = v;
+            bestSuffix = count == 0 ? x : max(bestSuffix + x, x);
+            bestPrefix = count == 0 ? x : max(bestPrefix, total + x);
+            best = max(best, bestSuffix);
+            total += x;
+            count++;
+        }
+    }
+
+    void merge(const KadaneState& right) {
+        if (right.count == 0) return;
+        if (count == 0) {
+            *this = right;
+            return;
+        }
+        best = max({best, right.best, bestSuffix + right.bestPrefix});
+        bestPrefix = max(bestPrefix, total + right.bestPrefix);
+        bestSuffix = max(right.bestSuffix, right.total + bestSuffix);
+        total += right.total;
+        count += right.count;
+    }
+
+    // Maximum subarray sum, LLONG_MIN if nothing was fed
+    long long result() const { return best; }
+};
+
+// ========================================
+// 2. MAJORITY ELEMENT (mergeable, two passes)
+// ========================================
+// Concept: Boyer-Moore voting. Two (candidate, count) states merge by
+// cancelling votes: equal candidates add, different ones subtract and
+// the larger count survives. The candidate still has to be verified
+// with a second pass (MajorityCountState), like the original.
+// Usage: MajorityState s; s.feed(chunk)...; MajorityCountState c(s.candidate);
+//        c.feed(chunk)...; c.result()
+// Example: {2, 2, 1} then {1, 2, 2, 2} gives 2
+struct MajorityState {
+    int candidate = -1;
+    long long votes = 0;
+
+    void feed(Span<int> chunk) {
+        for (int x : chunk) {
+            if (votes == 0) {
+                candidate = x;
+                votes = 1;
+            } else if (x == candidate) {
+                votes++;
+            } else {
+                votes--;
+            }
+        }
+    }
+
+    void merge(const MajorityState& right) {
+        if (right.votes == 0) return;
+        if (candidate == right.candidate) {
+            votes += right.votes;
+        } else if (votes >= right.votes) {
+            votes -= right.votes;
+        } else {
+            candidate = right.candidate;
+            votes = right.votes - votes;
+        }
+    }
+};
+
+struct MajorityCountState {
+    int candidate;
+    long long matches = 0;
+    long long total = 0;
+
+    explicit MajorityCountState(int cand = -1) : candidate(cand) {}
+
+    void feed(Span<int> chunk) {
+        for (int x : chunk) matches += (x == candidate);
+        total += chunk.size();
+    }
+
+    void merge(const MajorityCountState& right) {
+        matches += right.matches;
+        total += right.total;
+    }
+
+    // Majority element, or -1 if none
+    int result() const { return matches > total / 2 ? candidate : -1; }
+};
+
+// ========================================
+// 3. STOCK BUY AND SELL (mergeable)
+// ========================================
+// Concept: A segment is (min price, max price, best profit). Across a
+// split the best trade buys at the left minimum and sells at the right
+// maximum.
+// Usage: StockProfitState s; s.feed(prices)...; s.result()
+// Example: {7, 1, 5} then {3, 6, 4} gives 5
+struct StockProfitState {
+    long long minPrice = LLONG_MAX;
+    long long maxPrice = LLONG_MIN;
+    long long bestProfit = 0;
+
+    void feed(Span<int> chunk) {
+        for (int p : chunk) {
+            if (minPrice != LLONG_MAX) bestProfit = max(bestProfit, p - minPrice);
+            minPrice = min(minPrice, (long long)p);
+            maxPrice = max(maxPrice, (long long)p);
+        }
+    }
+
+    void merge(const StockProfitState& right) {
+        if (right.minPrice == LLONG_MAX) return;
+        if (minPrice != LLONG_MAX) {
+            bestProfit = max({bestProfit, right.bestProfit, right.maxPrice - minPrice});
+        } else {
+            bestProfit = right.bestProfit;
+        }
+        minPrice = min(minPrice, right.minPrice);
+        maxPrice = max(maxPrice, right.maxPrice);
+    }
+
+    long long result() const { return bestProfit; }
+};
+
+// ========================================
+// 4. FIND MISSING NUMBER (mergeable)
+// ========================================
+// Concept: XOR of the values against XOR of 1..n+1 (closed form by n % 4)
+// instead of the sum formula, so there is no overflow for any n.
+// Usage: MissingNumberState s; s.feed(chunk)...; s.result()
+// Example: {1, 2} then {4, 5} gives 3
+struct MissingNumberState {
+    unsigned long long xorValues = 0;
+    unsigned long long count = 0;
+
+    // 1 ^ 2 ^ ... ^ m
+    static unsigned long long xorUpTo(unsigned long long m) {
+        switch (m % 4) {
+            case 0: return m;
+            case 1: return 1;
+            case 2: return m + 1;
+            default: return 0;
+        }
+    }
+
+    void feed(Span<int> chunk) {
+        for (int x : chunk) xorValues ^= (unsigned long long)x;
+        count += chunk.size();
+    }
+
+    void merge(const MissingNumberState& right) {
+        xorValues ^= right.xorValues;
+        count += right.count;
+    }
+
+    long long result() const { return (long long)(xorValues ^ xorUpTo(count + 1)); }
+};
+
+// ========================================
+// 5. TRAPPING RAIN WATER (streaming only)
+// ========================================
+// Concept: Monotonic stack of (position, height) with decreasing
+// heights. A taller bar closes off every lower bar on the stack and
+// the water above it is added immediately, so the answer is final as
+// soon as the input ends. Memory is the number of steps in the current
+// descending staircase: O(1) for typical terrain, O(n) only for input
+// that keeps decreasing.
+// Not mergeable: the water above a bar depends on the maxima on both
+// sides of it, which a fixed-size summary cannot capture.
+// Usage: RainWaterState s; s.feed(heights)...; s.result()
+// Example: {0, 1, 0, 2, 1, 0} then {1, 3, 2, 1, 2, 1} gives 6
+struct RainWaterState {
+    struct Bar {
+        long long pos;
+        int height;
+    };
+    vector<Bar> stack;
+    long long position = 0;
+    long long water = 0;
+
+    void feed(Span<int> chunk) {
+        for (int h : chunk) {
+            while (!stack.empty() && h > stack.back().height) {
+                Bar bottom = stack.back();
+                stack.pop_back();
+                if (stack.empty()) break;
+                const Bar& wall = stack.back();
+                long long width = position - wall.pos - 1;
+                water += width * (min(h, wall.height) - bottom.height);
+            }
+            // An equal bar replaces the previous one as the left wall
+            if (!stack.empty() && stack.back().height == h) stack.back().pos = position;
+            else stack.push_back({position, h});
+            position++;
+        }
+    }
+
+    long long result() const { return water; }
+};
+
+// ========================================
+// DRIVERS
+// ========================================
+
+// Usage: feedStream(state, cin, 65536) - reads whitespace-separated ints
+// from a file / socket stream in chunks of chunkSize values
+template <typename State>
+void feedStream(State& state, istream& in, size_t chunkSize) {
+    vector<int> buffer;
+    buffer.reserve(chunkSize);
+    int x;
+    while (in >> x) {
+        buffer.push_back(x);
+        if (buffer.size() == chunkSize) {
+            state.feed(Span<int>(buffer));
+            buffer.clear();
+        }
+    }
+    if (!buffer.empty()) state.feed(Span<int>(buffer));
+}
+
+// Usage: result = feedInParallel(arr, n, threads, KadaneState()).result()
+// Splits the array into one chunk per thread, feeds each chunk into a
+// copy of init, then merges the partial states left to right.
+template <typename State>
+State feedInParallel(const int* arr, size_t n, size_t threads, const State& init) {
+    if (threads == 0) threads = 1;
+    vector<State> parts(threads, init);
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        size_t lo = n * t / threads, hi = n * (t + 1) / threads;
+        workers.emplace_back([&parts, arr, t, lo, hi] { parts[t].feed(Span<int>(arr + lo, hi - lo)); });
+    }
+    for (auto& w : workers) w.join();
+    State total = parts[0];
+    for (size_t t = 1; t < threads; t++) total.merge(parts[t]);
+    return total;
+}
+
+// Usage: majority = majorityInParallel(arr, n, threads) - both passes
+int majorityInParallel(const int* arr, size_t n, size_t threads) {
+    MajorityState vote = feedInParallel(arr, n, threads, MajorityState());
+    return feedInParallel(arr, n, threads, MajorityCountState(vote.candidate)).result();
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Streaming Array Algorithms ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // int chunk1[] = {-2, 1, -3, 4};
+    // int chunk2[] = {-1, 2, 1, -5, 4};
+
+    // 1. Kadane, fed chunk by chunk
+    // KadaneState kadane;
+    // kadane.feed(chunk1);
+    // kadane.feed(chunk2);
+    // cout << "Maximum subarray sum: " << kadane.result() << endl;
+
+    // 1b. Kadane, chunks processed separately and merged
+    // KadaneState left, right;
+    // left.feed(chunk1);
+    // right.feed(chunk2);
+    // left.merge(right);
+    // cout << "Maximum subarray sum (merged): " << left.result() << endl;
+
+    // 2. Majority element (two passes)
+    // int votes[] = {2, 2, 1, 1, 2, 2, 2};
+    // MajorityState vote;
+    // vote.feed(votes);
+    // MajorityCountState check(vote.candidate);
+    // check.feed(votes);
+    // cout << "Majority element: " << check.result() << endl;
+
+    // 3. Stock profit
+    // int prices[] = {7, 1, 5, 3, 6, 4};
+    // StockProfitState stock;
+    // stock.feed(prices);
+    // cout << "Maximum profit: " << stock.result() << endl;
+
+    // 4. Missing number
+    // int values[] = {1, 2, 4, 5};
+    // MissingNumberState missing;
+    // missing.feed(values);
+    // cout << "Missing number: " << missing.result() << endl;
+
+    // 5. Rain water from a stream
+    // istringstream terrain("0 1 0 2 1 0 1 3 2 1 2 1");
+    // RainWaterState rain;
+    // feedStream(rain, terrain, 4);
+    // cout << "Water trapped: " << rain.result() << " units" << endl;
+
+    // Parallel chunks
+    // vector<int> big(10000000);
+    // for (size_t i = 0; i < big.size(); i++) big[i] = (int)(i % 200) - 100;
+    // cout << "Kadane (4 threads): "
+    //      << feedInParallel(big.data(), big.size(), 4, KadaneState()).result() << endl;
+    // cout << "Majority (4 threads): " << majorityInParallel(big.data(), big.size(), 4) << endl;
+
+    return 0;
+}
@@ -1,62 +1,257 @@
 #include <iostream>
 #include <queue>
+#include <memory>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include <chrono>
 using namespace std;
 
 // ========================================
-// QUEUE IMPLEMENTATION USING ARRAY
+// RING QUEUE (GROWABLE, TEMPLATED)
 // ========================================
+// Concept: Circular buffer with power-of-two capacity
+// - Index wrap-around uses "& mask" instead of "% capacity"
+// - Capacity doubles when full (amortized O(1) enqueue)
+// - Elements live in raw storage, so move-only types are supported
+// - enqueue_n / dequeue_n copy whole contiguous spans (at most two per call)
+// - No I/O on the hot path
+template <typename T>
+class RingQueue {
+private:
+    T* buf;
+    size_t cap;     // Always 0 or a power of two
+    size_t mask;    // cap - 1
+    size_t head;    // Free-running read counter (masked on access)
+    size_t tail;    // Free-running write counter; size = tail - head
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    // Move n elements from src to uninitialized dst, destroying the sources
+    static void relocate(T* dst, T* src, size_t n) {
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (n) memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                new (dst + i) T(std::move(src[i]));
+                src[i].~T();
+            }
+        }
+    }
+
+    size_t grownCapacity(size_t minCap) const {
+        size_t newCap = roundUpPow2(minCap < 16 ? 16 : minCap);
+        return newCap < cap * 2 ? cap * 2 : newCap;
+    }
+
+    void grow(size_t minCap) {
+        size_t newCap = grownCapacity(minCap);
+        adopt(allocator<T>().allocate(newCap), newCap);
+    }
+
+    // Slow path of emplace on a full queue. The new element is built in
+    // the new buffer before the old one is released, so args may refer
+    // to elements of this queue (e.g. q.enqueue(q.front()))
+    template <typename... Args>
+    T& growAndEmplace(Args&&... args) {
+        size_t count = tail - head;
+        size_t newCap = grownCapacity(cap + 1);
+        T* newBuf = allocator<T>().allocate(newCap);
+        try {
+            new (newBuf + count) T(std::forward<Args>(args)...);
+        } catch (...) {
+            allocator<T>().deallocate(newBuf, newCap);
+            throw;
+        }
+        adopt(newBuf, newCap);
+        tail++;
+        return newBuf[count];
+    }
+
+    // Move the live elements to the front of newBuf and free the old buffer
+    void adopt(T* newBuf, size_t newCap) {
+        // Unwrap the two live segments into [0, count)
+        size_t count = tail - head;
+        size_t start = head & mask;
+        size_t first = min(count, cap - start);
+        relocate(newBuf, buf + start, first);
+        relocate(newBuf + first, buf, count - first);
+
+        if (buf) allocator<T>().deallocate(buf, cap);
+        buf = newBuf;
+        cap = newCap;
+        mask = newCap - 1;
+        head = 0;
+        tail = count;
+    }
+
+public:
+    RingQueue() : buf(nullptr), cap(0), mask(0), head(0), tail(0) {}
+
+    explicit RingQueue(size_t initialCapacity) : RingQueue() {
+        reserve(initialCapacity);
+    }
+
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+
+    RingQueue(RingQueue&& other) noexcept
+        : buf(other.buf), cap(other.cap), mask(other.mask), head(other.head), tail(other.tail) {
+        other.buf = nullptr;
+        other.cap = other.mask = other.head = other.tail = 0;
+    }
+
+    RingQueue& operator=(RingQueue&& other) noexcept {
+        if (this != &other) {
+            clear();
+            if (buf) allocator<T>().deallocate(buf, cap);
+            buf = other.buf; cap = other.cap; mask = other.mask;
+            head = other.head; tail = other.tail;
+            other.buf = nullptr;
+            other.cap = other.mask = other.head = other.tail = 0;
+        }
+        return *this;
+    }
+
+    ~RingQueue() {
+        clear();
+        if (buf) allocator<T>().deallocate(buf, cap);
+    }
+
+    bool isEmpty() const { return head == tail; }
+    size_t size() const { return tail - head; }
+    size_t capacity() const { return cap; }
+
+    // Ensure room for at least n elements without further allocation
+    void reserve(size_t n) {
+        if (n > cap) grow(n);
+    }
+
+    void enqueue(const T& value) { emplace(value); }
+    void enqueue(T&& value) { emplace(std::move(value)); }
+
+    // args may refer to an element of this queue, even when it is full
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (tail - head == cap) return growAndEmplace(std::forward<Args>(args)...);
+        T* slot = buf + (tail & mask);
+        new (slot) T(std::forward<Args>(args)...);
+        tail++;
+        return *slot;
+    }
+
+    // Precondition: !isEmpty()
+    T& front() { return buf[head & mask]; }
+    const T& front() const { return buf[head & mask]; }
+    T& back() { return buf[(tail - 1) & mask]; }
+
+    // Precondition: !isEmpty()
+    void pop() {
+        buf[head & mask].~T();
+        head++;
+    }
+
+    // Returns false (and leaves out untouched) if the queue is empty
+    bool dequeue(T& out) {
+        if (head == tail) return false;
+        out = std::move(buf[head & mask]);
+        pop();
+        return true;
+    }
+
+    // Copy n elements from src onto the back in at most two span copies
+    void enqueue_n(const T* src, size_t n) {
+        if (tail - head + n > cap) grow(tail - head + n);
+        size_t start = tail & mask;
+        size_t first = min(n, cap - start);
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (first) memcpy(static_cast<void*>(buf + start), src, first * sizeof(T));
+            if (n > first) memcpy(static_cast<void*>(buf), src + first, (n - first) * sizeof(T));
+        } else {
+            uninitialized_copy_n(src, first, buf + start);
+            uninitialized_copy_n(src + first, n - first, buf);
+        }
+        tail += n;
+    }
+
+    // Move up to n elements from the front into dst; returns how many were taken
+    size_t dequeue_n(T* dst, size_t n) {
+        if (n > tail - head) n = tail - head;
+        size_t start = head & mask;
+        size_t first = min(n, cap - start);
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (first) memcpy(static_cast<void*>(dst), buf + start, first * sizeof(T));
+            if (n > first) memcpy(static_cast<void*>(dst + first), buf, (n - first) * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                T& slot = buf[(head + i) & mask];
+                dst[i] = std::move(slot);
+                slot.~T();
+            }
+        }
+        head += n;
+        return n;
+    }
 
-const int MAX_SIZE = 100;
+    void clear() {
+        if constexpr (!is_trivially_destructible<T>::value) {
+            for (size_t i = head; i != tail; i++) {
+                buf[i & mask].~T();
+            }
+        }
+        head = 0;
+        tail = 0;
+    }
+
+    // i-th element from the front (0 = front)
+    T& operator[](size_t i) { return buf[(head + i) & mask]; }
+    const T& operator[](size_t i) const { return buf[(head + i) & mask]; }
+};
+
+// ========================================
+// QUEUE IMPLEMENTATION USING RING QUEUE
+// ========================================
+// Same interface as the old fixed-size array queue, but backed by
+// RingQueue<int> so it grows instead of overflowing.
 
 class Queue {
 private:
-    int arr[MAX_SIZE];
-    int front, rear, count;
+    RingQueue<int> ring;
 
 public:
-    Queue() {
-        front = 0;
-        rear = -1;
-        count = 0;
-    }
+    Queue() {}
 
     // Check if queue is empty
     bool isEmpty() {
-        return count == 0;
+        return ring.isEmpty();
     }
 
-    // Check if queue is full
+    // Growable queue is never full
     bool isFull() {
-        return count == MAX_SIZE;
+        return false;
     }
 
     // Get current size
     int size() {
-        return count;
+        return (int)ring.size();
     }
 
     // Enqueue element
     void enqueue(int value) {
-        if (isFull()) {
-            cout << "Queue Overflow! Cannot enqueue " << value << endl;
-            return;
-        }
-        rear = (rear + 1) % MAX_SIZE;
-        arr[rear] = value;
-        count++;
-        cout << "Enqueued " << value << " to queue." << endl;
+        ring.enqueue(value);
     }
 
     // Dequeue element
     int dequeue() {
-        if (isEmpty()) {
+        int value;
+        if (!ring.dequeue(value)) {
             cout << "Queue Underflow! Cannot dequeue." << endl;
             return -1;
         }
-        int value = arr[front];
-        front = (front + 1) % MAX_SIZE;
-        count--;
-        cout << "Dequeued " << value << " from queue." << endl;
         return value;
     }
 
@@ -66,7 +261,7 @@ public:
             cout << "Queue is empty!" << endl;
             return -1;
         }
-        return arr[front];
+        return ring.front();
     }
 
     // Display queue
@@ -76,10 +271,8 @@ public:
             return;
         }
         cout << "Queue (front to rear): ";
-        int idx = front;
-        for (int i = 0; i < count; i++) {
-            cout << arr[idx] << " ";
-            idx = (idx + 1) % MAX_SIZE;
+        for (size_t i = 0; i < ring.size(); i++) {
+            cout << ring[i] << " ";
         }
         cout << endl;
     }
@@ -88,52 +281,32 @@ public:
 // ========================================
 // CIRCULAR QUEUE IMPLEMENTATION
 // ========================================
+// RingQueue is already circular; CircularQueue keeps the old name and
+// demo output on top of it.
 
 class CircularQueue {
 private:
-    int arr[MAX_SIZE];
-    int front, rear;
+    RingQueue<int> ring;
 
 public:
-    CircularQueue() {
-        front = -1;
-        rear = -1;
-    }
-
     bool isEmpty() {
-        return front == -1;
+        return ring.isEmpty();
     }
 
     bool isFull() {
-        return (rear + 1) % MAX_SIZE == front;
+        return false;
     }
 
     void enqueue(int value) {
-        if (isFull()) {
-            cout << "Circular Queue is full!" << endl;
-            return;
-        }
-        if (isEmpty()) {
-            front = rear = 0;
-        } else {
-            rear = (rear + 1) % MAX_SIZE;
-        }
-        arr[rear] = value;
-        cout << "Enqueued " << value << " to circular queue." << endl;
+        ring.enqueue(value);
     }
 
     int dequeue() {
-        if (isEmpty()) {
+        int value;
+        if (!ring.dequeue(value)) {
             cout << "Circular Queue is empty!" << endl;
             return -1;
         }
-        int value = arr[front];
-        if (front == rear) {
-            front = rear = -1;
-        } else {
-            front = (front + 1) % MAX_SIZE;
-        }
-        cout << "Dequeued " << value << " from circular queue." << endl;
         return value;
     }
 
@@ -143,11 +316,8 @@ public:
             return;
         }
         cout << "Circular Queue: ";
-        int i = front;
-        while (true) {
-            cout << arr[i] << " ";
-            if (i == rear) break;
-            i = (i + 1) % MAX_SIZE;
+        for (size_t i = 0; i < ring.size(); i++) {
+            cout << ring[i] << " ";
         }
         cout << endl;
     }
@@ -192,6 +362,58 @@ void displayQueue(Queue& queue) {
     queue.display();
 }
 
+// ========================================
+// BENCHMARK: RingQueue<int> vs std::queue<int>
+// ========================================
+// Usage: benchmarkRingQueue(ops)
+// Example: benchmarkRingQueue(10000000) - runs ops enqueue/dequeue pairs per variant
+// Pattern: bursts of 64 enqueues followed by 64 dequeues, plus a bulk-span run
+void benchmarkRingQueue(int ops) {
+    using Clock = chrono::steady_clock;
+    const int burst = 64;
+    long long checksum = 0;
+
+    auto report = [&](const char* name, Clock::time_point start) {
+        double secs = chrono::duration<double>(Clock::now() - start).count();
+        cout << name << ": " << (2.0 * ops / secs / 1e6) << " Mops/s" << endl;
+    };
+
+    {
+        queue<int> q;
+        auto start = Clock::now();
+        for (int i = 0; i < ops; i += burst) {
+            for (int j = 0; j < burst; j++) q.push(i + j);
+            for (int j = 0; j < burst; j++) { checksum += q.front(); q.pop(); }
+        }
+        report("std::queue<int>          ", start);
+    }
+
+    {
+        RingQueue<int> q;
+        auto start = Clock::now();
+        for (int i = 0; i < ops; i += burst) {
+            for (int j = 0; j < burst; j++) q.enqueue(i + j);
+            for (int j = 0; j < burst; j++) { checksum += q.front(); q.pop(); }
+        }
+        report("RingQueue<int>           ", start);
+    }
+
+    {
+        RingQueue<int> q;
+        int in[burst], out[burst];
+        auto start = Clock::now();
+        for (int i = 0; i < ops; i += burst) {
+            for (int j = 0; j < burst; j++) in[j] = i + j;
+            q.enqueue_n(in, burst);
+            q.dequeue_n(out, burst);
+            for (int j = 0; j < burst; j++) checksum += out[j];
+        }
+        report("RingQueue<int> (bulk_n)  ", start);
+    }
+
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
 // ========================================
 // MAIN FUNCTION
 // ========================================
@@ -251,5 +473,14 @@ int main() {
     // cq.enqueue(4);
     // cq.display();
     
+    // Enqueue an element of the queue itself (safe even when it must grow)
+    // RingQueue<string> words;
+    // words.enqueue("front");
+    // for (int i = 0; i < 20; i++) words.enqueue(words.front());
+    // cout << "Copies of front: " << words.size() << endl;
+    
+    // Benchmark against std::queue<int>
+    // benchmarkRingQueue(10000000);
+    
     return 0;
 }
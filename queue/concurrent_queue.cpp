@@ -0,0 +1,813 @@
+#include <iostream>
+#include <queue>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread concurrent_queue.cpp
+
+// ========================================
+// UTILITY FUNCTIONS
+// ========================================
+
+const size_t CACHE_LINE = 64;
+
+// Tell the CPU we are in a spin-wait loop
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    this_thread::yield();
+#endif
+}
+
+// Spin briefly, then start yielding so a waiting thread does not starve
+// the thread it is waiting on (matters when both share a core)
+class Backoff {
+private:
+    int spins = 0;
+
+public:
+    void pause() {
+        if (spins < 64) {
+            cpuRelax();
+            spins++;
+        } else {
+            this_thread::yield();
+        }
+    }
+
+    void reset() {
+        spins = 0;
+    }
+};
+
+// Pin the calling thread to a CPU (wraps around the available CPUs)
+// Usage: pinThreadToCore(1) - returns false if pinning is unsupported or fails
+bool pinThreadToCore(int core) {
+#ifdef __linux__
+    int cpus = (int)thread::hardware_concurrency();
+    if (cpus <= 0) cpus = 1;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cpus, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+// ========================================
+// 1. SPSC LOCK-FREE RING BUFFER
+// ========================================
+// Concept: CircularQueue split between exactly one producer and one consumer
+// - Producer owns tail, consumer owns head; each is on its own cache line
+// - Publishing uses release stores, observing uses acquire loads
+// - Each side caches the other side's index and only re-reads the shared
+//   atomic when the cached value says "full" / "empty"
+// - Batch push/pop publish many elements with a single release store
+// Usage: SPSCQueue<int> q(1024); q.try_push(x); q.try_pop(x);
+template <typename T>
+class SPSCQueue {
+private:
+    // Read-only after construction
+    alignas(CACHE_LINE) T* buf;
+    size_t cap;    // Power of two
+    size_t mask;
+
+    // Consumer side
+    alignas(CACHE_LINE) atomic<size_t> head;
+    size_t cachedTail;
+
+    // Producer side
+    alignas(CACHE_LINE) atomic<size_t> tail;
+    size_t cachedHead;
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    // Producer: number of free slots, refreshing the cached head if needed
+    size_t freeSlots(size_t t, size_t wanted) {
+        size_t freeCount = cap - (t - cachedHead);
+        if (freeCount < wanted) {
+            cachedHead = head.load(memory_order_acquire);
+            freeCount = cap - (t - cachedHead);
+        }
+        return freeCount;
+    }
+
+    // Consumer: number of ready elements, refreshing the cached tail if needed
+    size_t readySlots(size_t h, size_t wanted) {
+        size_t ready = cachedTail - h;
+        if (ready < wanted) {
+            cachedTail = tail.load(memory_order_acquire);
+            ready = cachedTail - h;
+        }
+        return ready;
+    }
+
+public:
+    explicit SPSCQueue(size_t capacity)
+        : cap(roundUpPow2(capacity < 2 ? 2 : capacity)), mask(cap - 1),
+          head(0), cachedTail(0), tail(0), cachedHead(0) {
+        buf = allocator<T>().allocate(cap);
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    ~SPSCQueue() {
+        size_t h = head.load(memory_order_relaxed);
+        size_t t = tail.load(memory_order_relaxed);
+        for (; h != t; h++) {
+            buf[h & mask].~T();
+        }
+        allocator<T>().deallocate(buf, cap);
+    }
+
+    size_t capacity() const { return cap; }
+
+    // Approximate when called concurrently
+    size_t size() const {
+        return tail.load(memory_order_acquire) - head.load(memory_order_acquire);
+    }
+
+    bool isEmpty() const { return size() == 0; }
+
+    // Producer only. Returns false if the queue is full.
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t t = tail.load(memory_order_relaxed);
+        if (freeSlots(t, 1) == 0) return false;
+        new (buf + (t & mask)) T(std::forward<Args>(args)...);
+        tail.store(t + 1, memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool try_pop(T& out) {
+        size_t h = head.load(memory_order_relaxed);
+        if (readySlots(h, 1) == 0) return false;
+        T& slot = buf[h & mask];
+        out = std::move(slot);
+        slot.~T();
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+
+    // Producer only. Pushes up to n elements; returns how many were pushed.
+    size_t try_push_n(const T* src, size_t n) {
+        size_t t = tail.load(memory_order_relaxed);
+        n = min(n, freeSlots(t, n));
+        if (n == 0) return 0;
+        size_t start = t & mask;
+        size_t first = min(n, cap - start);
+        if constexpr (is_trivially_copyable<T>::value) {
+            memcpy(static_cast<void*>(buf + start), src, first * sizeof(T));
+            if (n > first) memcpy(static_cast<void*>(buf), src + first, (n - first) * sizeof(T));
+        } else {
+            uninitialized_copy_n(src, first, buf + start);
+            uninitialized_copy_n(src + first, n - first, buf);
+        }
+        tail.store(t + n, memory_order_release);
+        return n;
+    }
+
+    // Consumer only. Pops up to n elements into dst; returns how many were popped.
+    size_t try_pop_n(T* dst, size_t n) {
+        size_t h = head.load(memory_order_relaxed);
+        n = min(n, readySlots(h, n));
+        if (n == 0) return 0;
+        size_t start = h & mask;
+        size_t first = min(n, cap - start);
+        if constexpr (is_trivially_copyable<T>::value) {
+            memcpy(static_cast<void*>(dst), buf + start, first * sizeof(T));
+            if (n > first) memcpy(static_cast<void*>(dst + first), buf, (n - first) * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                T& slot = buf[(h + i) & mask];
+                dst[i] = std::move(slot);
+                slot.~T();
+            }
+        }
+        head.store(h + n, memory_order_release);
+        return n;
+    }
+};
+
+// ========================================
+// WAIT STRATEGY: EVENT COUNT
+// ========================================
+// Concept: Lets idle threads sleep in the kernel instead of spinning
+// - Waiter: key = prepareWait(); re-check the queue; wait(key) or cancelWait()
+// - Notifier: change the queue, then notifyAll(); this is a single atomic
+//   load when nobody is waiting
+// - Linux sleeps on a futex over the epoch word, other platforms fall back
+//   to a mutex + condition_variable
+class EventCount {
+private:
+    alignas(CACHE_LINE) atomic<uint32_t> epoch;
+    atomic<int> waiters;
+#ifndef __linux__
+    mutex m;
+    condition_variable cv;
+#endif
+
+public:
+    EventCount() : epoch(0), waiters(0) {}
+
+    uint32_t prepareWait() {
+        waiters.fetch_add(1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+        return epoch.load(memory_order_acquire);
+    }
+
+    void cancelWait() {
+        waiters.fetch_sub(1, memory_order_relaxed);
+    }
+
+    // Sleeps until notified after prepareWait() returned key.
+    // Returns false if the deadline passed first.
+    bool wait(uint32_t key, chrono::steady_clock::time_point deadline) {
+        bool notified = true;
+#ifdef __linux__
+        while (epoch.load(memory_order_acquire) == key) {
+            auto now = chrono::steady_clock::now();
+            if (now >= deadline) {
+                notified = false;
+                break;
+            }
+            auto left = chrono::duration_cast<chrono::nanoseconds>(deadline - now).count();
+            timespec ts;
+            ts.tv_sec = (time_t)(left / 1000000000);
+            ts.tv_nsec = (long)(left % 1000000000);
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAIT_PRIVATE,
+                    key, &ts, nullptr, 0);
+        }
+#else
+        unique_lock<mutex> lock(m);
+        notified = cv.wait_until(lock, deadline, [&] {
+            return epoch.load(memory_order_acquire) != key;
+        });
+#endif
+        waiters.fetch_sub(1, memory_order_relaxed);
+        return notified;
+    }
+
+    void wait(uint32_t key) {
+        wait(key, chrono::steady_clock::time_point::max());
+    }
+
+    void notifyAll() {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (waiters.load(memory_order_relaxed) == 0) return;
+#ifdef __linux__
+        epoch.fetch_add(1, memory_order_release);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAKE_PRIVATE,
+                INT_MAX, nullptr, nullptr, 0);
+#else
+        lock_guard<mutex> lock(m);
+        epoch.fetch_add(1, memory_order_release);
+        cv.notify_all();
+#endif
+    }
+};
+
+// ========================================
+// 2. MPMC BOUNDED QUEUE (PER-SLOT SEQUENCE NUMBERS)
+// ========================================
+// Concept: Dmitry Vyukov's bounded MPMC queue
+// - Every slot carries a sequence number telling whose turn it is:
+//   seq == pos       -> free, producer for ticket pos may write
+//   seq == pos + 1   -> full, consumer for ticket pos may read
+// - Producers/consumers claim tickets with a CAS on their own counter, so
+//   the only contention is between threads on the same side
+// - try_* never block, push/pop block, try_*_for give up after a timeout;
+//   blocked threads sleep on an EventCount
+// Usage: MPMCQueue<int> q(1024); q.push(x); q.pop(x); q.try_pop_for(x, 10ms);
+template <typename T>
+class MPMCQueue {
+private:
+    struct alignas(CACHE_LINE) Slot {
+        atomic<size_t> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* item() { return reinterpret_cast<T*>(storage); }
+    };
+
+    Slot* slots;
+    size_t cap;    // Power of two
+    size_t mask;
+
+    alignas(CACHE_LINE) atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE) atomic<size_t> dequeuePos;
+
+    EventCount notEmpty;
+    EventCount notFull;
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    // Claims a slot for writing, or returns nullptr if the queue is full
+    Slot* claimForPush(size_t& pos) {
+        pos = enqueuePos.load(memory_order_relaxed);
+        while (true) {
+            Slot* slot = &slots[pos & mask];
+            size_t seq = slot->seq.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    return slot;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claims a slot for reading, or returns nullptr if the queue is empty
+    Slot* claimForPop(size_t& pos) {
+        pos = dequeuePos.load(memory_order_relaxed);
+        while (true) {
+            Slot* slot = &slots[pos & mask];
+            size_t seq = slot->seq.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    return slot;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    explicit MPMCQueue(size_t capacity)
+        : cap(roundUpPow2(capacity < 2 ? 2 : capacity)), mask(cap - 1),
+          enqueuePos(0), dequeuePos(0) {
+        slots = new Slot[cap];
+        for (size_t i = 0; i < cap; i++) {
+            slots[i].seq.store(i, memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    ~MPMCQueue() {
+        size_t e = enqueuePos.load(memory_order_relaxed);
+        for (size_t d = dequeuePos.load(memory_order_relaxed); d != e; d++) {
+            slots[d & mask].item()->~T();
+        }
+        delete[] slots;
+    }
+
+    size_t capacity() const { return cap; }
+
+    // Approximate when called concurrently
+    size_t size() const {
+        size_t e = enqueuePos.load(memory_order_acquire);
+        size_t d = dequeuePos.load(memory_order_acquire);
+        return e > d ? e - d : 0;
+    }
+
+    // Non-blocking. Returns false (value untouched) if the queue is full.
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t pos;
+        Slot* slot = claimForPush(pos);
+        if (!slot) return false;
+        new (slot->item()) T(std::forward<Args>(args)...);
+        slot->seq.store(pos + 1, memory_order_release);
+        notEmpty.notifyAll();
+        return true;
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    // Non-blocking. Returns false if the queue is empty.
+    bool try_pop(T& out) {
+        size_t pos;
+        Slot* slot = claimForPop(pos);
+        if (!slot) return false;
+        out = std::move(*slot->item());
+        slot->item()->~T();
+        slot->seq.store(pos + mask + 1, memory_order_release);
+        notFull.notifyAll();
+        return true;
+    }
+
+    // Timed. Gives up and returns false once timeout has elapsed.
+    template <typename Rep, typename Period>
+    bool try_push_for(T value, chrono::duration<Rep, Period> timeout) {
+        auto deadline = chrono::steady_clock::now() + timeout;
+        while (!try_push(std::move(value))) {
+            uint32_t key = notFull.prepareWait();
+            if (try_push(std::move(value))) {
+                notFull.cancelWait();
+                return true;
+            }
+            if (!notFull.wait(key, deadline)) {
+                return try_push(std::move(value));
+            }
+        }
+        return true;
+    }
+
+    template <typename Rep, typename Period>
+    bool try_pop_for(T& out, chrono::duration<Rep, Period> timeout) {
+        auto deadline = chrono::steady_clock::now() + timeout;
+        while (!try_pop(out)) {
+            uint32_t key = notEmpty.prepareWait();
+            if (try_pop(out)) {
+                notEmpty.cancelWait();
+                return true;
+            }
+            if (!notEmpty.wait(key, deadline)) {
+                return try_pop(out);
+            }
+        }
+        return true;
+    }
+
+    // Blocking. Spins briefly, then sleeps until there is room.
+    void push(T value) {
+        Backoff backoff;
+        for (int i = 0; i < 64; i++) {
+            if (try_push(std::move(value))) return;
+            backoff.pause();
+        }
+        while (!try_push(std::move(value))) {
+            uint32_t key = notFull.prepareWait();
+            if (try_push(std::move(value))) {
+                notFull.cancelWait();
+                return;
+            }
+            notFull.wait(key);
+        }
+    }
+
+    // Blocking. Spins briefly, then sleeps until an element arrives.
+    void pop(T& out) {
+        Backoff backoff;
+        for (int i = 0; i < 64; i++) {
+            if (try_pop(out)) return;
+            backoff.pause();
+        }
+        while (!try_pop(out)) {
+            uint32_t key = notEmpty.prepareWait();
+            if (try_pop(out)) {
+                notEmpty.cancelWait();
+                return;
+            }
+            notEmpty.wait(key);
+        }
+    }
+};
+
+// ========================================
+// MUTEX-WRAPPED QUEUE (BASELINE)
+// ========================================
+// What callers had before: a plain queue behind a lock
+template <typename T>
+class LockedQueue {
+private:
+    queue<T> q;
+    mutex m;
+
+public:
+    bool try_push(const T& value) {
+        lock_guard<mutex> lock(m);
+        q.push(value);
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        lock_guard<mutex> lock(m);
+        if (q.empty()) return false;
+        out = std::move(q.front());
+        q.pop();
+        return true;
+    }
+};
+
+// ========================================
+// BENCHMARK: SPSC THROUGHPUT AND LATENCY
+// ========================================
+// Usage: benchmarkSPSC(items)
+// Example: benchmarkSPSC(10000000) - streams items from a producer thread to a
+// consumer thread pinned to cores 0 and 1, then measures ping-pong latency
+template <typename Q>
+double spscThroughput(Q& q, long long items) {
+    long long sum = 0;
+    auto start = chrono::steady_clock::now();
+
+    thread consumer([&] {
+        pinThreadToCore(1);
+        Backoff backoff;
+        long long value = 0;
+        for (long long received = 0; received < items;) {
+            if (q.try_pop(value)) {
+                sum += value;
+                received++;
+                backoff.reset();
+            } else {
+                backoff.pause();
+            }
+        }
+    });
+
+    // The producer gets its own thread too, so pinning never touches the caller
+    thread producer([&] {
+        pinThreadToCore(0);
+        Backoff backoff;
+        for (long long i = 0; i < items;) {
+            if (q.try_push(i)) {
+                i++;
+                backoff.reset();
+            } else {
+                backoff.pause();
+            }
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (sum != items * (items - 1) / 2) cout << "  checksum mismatch!" << endl;
+    return items / secs / 1e6;
+}
+
+double spscBatchThroughput(SPSCQueue<long long>& q, long long items, size_t batch) {
+    long long sum = 0;
+    auto start = chrono::steady_clock::now();
+
+    thread consumer([&] {
+        pinThreadToCore(1);
+        vector<long long> out(batch);
+        Backoff backoff;
+        for (long long received = 0; received < items;) {
+            size_t got = q.try_pop_n(out.data(), batch);
+            if (got) {
+                for (size_t i = 0; i < got; i++) sum += out[i];
+                received += got;
+                backoff.reset();
+            } else {
+                backoff.pause();
+            }
+        }
+    });
+
+    thread producer([&] {
+        pinThreadToCore(0);
+        vector<long long> in(batch);
+        Backoff backoff;
+        for (long long i = 0; i < items;) {
+            size_t want = (size_t)min<long long>(batch, items - i);
+            for (size_t j = 0; j < want; j++) in[j] = i + j;
+            size_t sent = q.try_push_n(in.data(), want);
+            // Re-offer whatever did not fit on the next iteration
+            i += sent;
+            if (sent) backoff.reset(); else backoff.pause();
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    if (sum != items * (items - 1) / 2) cout << "  checksum mismatch!" << endl;
+    return items / secs / 1e6;
+}
+
+// Round trip through two queues; returns mean one-way latency in nanoseconds
+double spscLatency(int rounds) {
+    SPSCQueue<int> ping(64), pong(64);
+
+    thread echo([&] {
+        pinThreadToCore(1);
+        Backoff backoff;
+        int value;
+        for (int i = 0; i < rounds; i++) {
+            while (!ping.try_pop(value)) backoff.pause();
+            backoff.reset();
+            while (!pong.try_push(value)) backoff.pause();
+            backoff.reset();
+        }
+    });
+
+    double ns = 0;
+    thread pinger([&] {
+        pinThreadToCore(0);
+        Backoff backoff;
+        int value;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            while (!ping.try_push(i)) backoff.pause();
+            backoff.reset();
+            while (!pong.try_pop(value)) backoff.pause();
+            backoff.reset();
+        }
+        ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+    });
+    pinger.join();
+    echo.join();
+    return ns / rounds / 2;
+}
+
+void benchmarkSPSC(long long items) {
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+    {
+        LockedQueue<long long> q;
+        cout << "mutex + std::queue   : " << spscThroughput(q, items) << " M items/s" << endl;
+    }
+    {
+        SPSCQueue<long long> q(4096);
+        cout << "SPSCQueue            : " << spscThroughput(q, items) << " M items/s" << endl;
+    }
+    {
+        SPSCQueue<long long> q(4096);
+        cout << "SPSCQueue (batch 64) : " << spscBatchThroughput(q, items, 64) << " M items/s" << endl;
+    }
+    cout << "SPSCQueue one-way latency: " << spscLatency(100000) << " ns" << endl;
+}
+
+// ========================================
+// BENCHMARK: MPMC SCALING
+// ========================================
+// Usage: benchmarkMPMC(items, maxThreads)
+// Example: benchmarkMPMC(4000000, 4) - every producers x consumers combination
+// from 1x1 up to 4x4, comparing the mutex baseline, MPMCQueue with spinning
+// consumers and MPMCQueue with blocking (sleeping) consumers
+template <typename Q>
+double mpmcSpinThroughput(Q& q, long long items, int producers, int consumers) {
+    atomic<long long> consumed(0);
+    vector<thread> threads;
+    auto start = chrono::steady_clock::now();
+
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            pinThreadToCore(p);
+            Backoff backoff;
+            for (long long i = p; i < items; i += producers) {
+                while (!q.try_push(i)) backoff.pause();
+                backoff.reset();
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            pinThreadToCore(producers + c);
+            Backoff backoff;
+            long long value;
+            while (consumed.load(memory_order_relaxed) < items) {
+                if (q.try_pop(value)) {
+                    consumed.fetch_add(1, memory_order_relaxed);
+                    backoff.reset();
+                } else {
+                    backoff.pause();
+                }
+            }
+        });
+    }
+    for (thread& t : threads) t.join();
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return items / secs / 1e6;
+}
+
+double mpmcBlockingThroughput(MPMCQueue<long long>& q, long long items, int producers, int consumers) {
+    vector<thread> threads;
+    auto start = chrono::steady_clock::now();
+
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            pinThreadToCore(producers + c);
+            long long value;
+            while (true) {
+                q.pop(value);
+                if (value < 0) break;  // Poison pill
+            }
+        });
+    }
+    vector<thread> producerThreads;
+    for (int p = 0; p < producers; p++) {
+        producerThreads.emplace_back([&, p] {
+            pinThreadToCore(p);
+            for (long long i = p; i < items; i += producers) {
+                q.push(i);
+            }
+        });
+    }
+    for (thread& t : producerThreads) t.join();
+    for (int c = 0; c < consumers; c++) q.push(-1);
+    for (thread& t : threads) t.join();
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return items / secs / 1e6;
+}
+
+void benchmarkMPMC(long long items, int maxThreads) {
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+    cout << "P x C   mutex(M/s)   MPMC spin(M/s)   MPMC blocking(M/s)" << endl;
+    for (int p = 1; p <= maxThreads; p++) {
+        for (int c = 1; c <= maxThreads; c++) {
+            LockedQueue<long long> locked;
+            MPMCQueue<long long> spinQ(4096), blockQ(4096);
+            double lockedRate = mpmcSpinThroughput(locked, items, p, c);
+            double spinRate = mpmcSpinThroughput(spinQ, items, p, c);
+            double blockRate = mpmcBlockingThroughput(blockQ, items, p, c);
+            cout << p << " x " << c << "   " << lockedRate << "   " << spinRate
+                 << "   " << blockRate << endl;
+        }
+    }
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Concurrent Queues ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. SPSC Queue
+    // SPSCQueue<int> q(8);
+    // thread producer([&] {
+    //     for (int i = 1; i <= 20; i++) {
+    //         while (!q.try_push(i)) this_thread::yield();
+    //     }
+    // });
+    // int value, received = 0;
+    // while (received < 20) {
+    //     if (q.try_pop(value)) {
+    //         cout << value << " ";
+    //         received++;
+    //     }
+    // }
+    // cout << endl;
+    // producer.join();
+
+    // SPSC throughput / latency benchmark
+    // benchmarkSPSC(10000000);
+
+    // 2. MPMC Queue
+    // MPMCQueue<int> q(16);
+    // vector<thread> workers;
+    // for (int w = 0; w < 4; w++) {
+    //     workers.emplace_back([&] {
+    //         int value;
+    //         while (q.try_pop_for(value, chrono::milliseconds(100))) {
+    //             cout << value << " ";  // Output may interleave
+    //         }
+    //     });
+    // }
+    // for (int i = 1; i <= 20; i++) q.push(i);
+    // for (thread& t : workers) t.join();
+    // cout << endl;
+
+    // MPMC scaling benchmark (1..4 threads per side)
+    // benchmarkMPMC(4000000, 4);
+
+    return 0;
+}
@@ -1,77 +1,216 @@
 #include <iostream>
 #include <stack>
+#include <memory>
+#include <utility>
+#include <cstring>
+#include <type_traits>
 using namespace std;
 
 // ========================================
-// STACK IMPLEMENTATION USING ARRAY
+// STACK WITH SMALL-BUFFER OPTIMIZATION
 // ========================================
+// Concept: The first InlineN elements live inside the object itself, so
+// small stacks never touch the heap. Past that the elements spill to a heap
+// buffer that doubles on each growth (amortized O(1) push).
+// - emplace() constructs in place
+// - No I/O on push/pop; callers check isEmpty() before pop()/top()
 
-const int MAX_SIZE = 100;
-
+template <typename T = int, size_t InlineN = 16>
 class Stack {
 private:
-    int arr[MAX_SIZE];
-    int topIndex;
+    static const size_t INLINE_CAP = InlineN > 0 ? InlineN : 1;
+
+    alignas(T) unsigned char inlineBuf[INLINE_CAP * sizeof(T)];
+    T* data;
+    size_t count;
+    size_t cap;
+
+    T* inlineData() { return reinterpret_cast<T*>(inlineBuf); }
+    bool isInline() const { return data == reinterpret_cast<const T*>(inlineBuf); }
+
+    // Move n elements from src to uninitialized dst, destroying the sources
+    static void relocate(T* dst, T* src, size_t n) {
+        if constexpr (is_trivially_copyable<T>::value) {
+            if (n) memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                new (dst + i) T(std::move(src[i]));
+                src[i].~T();
+            }
+        }
+    }
+
+    void growTo(size_t newCap) {
+        T* newData = allocator<T>().allocate(newCap);
+        relocate(newData, data, count);
+        if (!isInline()) allocator<T>().deallocate(data, cap);
+        data = newData;
+        cap = newCap;
+    }
+
+    // Slow path of emplace on a full stack. The new element is built in
+    // the new buffer before the old elements move, so args may refer to
+    // elements of this stack (e.g. s.push(s.top()))
+    template <typename... Args>
+    T& growAndEmplace(Args&&... args) {
+        size_t newCap = cap * 2;
+        T* newData = allocator<T>().allocate(newCap);
+        try {
+            new (newData + count) T(std::forward<Args>(args)...);
+        } catch (...) {
+            allocator<T>().deallocate(newData, newCap);
+            throw;
+        }
+        relocate(newData, data, count);
+        if (!isInline()) allocator<T>().deallocate(data, cap);
+        data = newData;
+        cap = newCap;
+        return data[count++];
+    }
+
+    void release() {
+        clear();
+        if (!isInline()) allocator<T>().deallocate(data, cap);
+        data = inlineData();
+        cap = INLINE_CAP;
+    }
+
+    // Take over other's elements; other is left empty
+    void stealFrom(Stack& other) {
+        if (other.isInline()) {
+            relocate(data, other.data, other.count);
+        } else {
+            data = other.data;
+            cap = other.cap;
+            other.data = other.inlineData();
+            other.cap = INLINE_CAP;
+        }
+        count = other.count;
+        other.count = 0;
+    }
+
+    void copyFrom(const Stack& other) {
+        reserve(other.count);
+        for (size_t i = 0; i < other.count; i++) {
+            new (data + i) T(other.data[i]);
+        }
+        count = other.count;
+    }
 
 public:
-    Stack() {
-        topIndex = -1;
+    Stack() : data(inlineData()), count(0), cap(INLINE_CAP) {}
+
+    Stack(const Stack& other) : Stack() {
+        copyFrom(other);
+    }
+
+    Stack(Stack&& other) noexcept : Stack() {
+        stealFrom(other);
+    }
+
+    Stack& operator=(const Stack& other) {
+        if (this != &other) {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    Stack& operator=(Stack&& other) noexcept {
+        if (this != &other) {
+            release();
+            stealFrom(other);
+        }
+        return *this;
+    }
+
+    ~Stack() {
+        release();
     }
 
     // Check if stack is empty
-    bool isEmpty() {
-        return topIndex == -1;
+    bool isEmpty() const {
+        return count == 0;
     }
 
-    // Check if stack is full
-    bool isFull() {
-        return topIndex == MAX_SIZE - 1;
+    // Growable stack is never full
+    bool isFull() const {
+        return false;
     }
 
     // Get current size
-    int size() {
-        return topIndex + 1;
+    size_t size() const {
+        return count;
+    }
+
+    size_t capacity() const {
+        return cap;
+    }
+
+    // True while the elements still live in the inline buffer
+    bool usesInlineStorage() const {
+        return isInline();
+    }
+
+    void reserve(size_t n) {
+        if (n > cap) growTo(n);
     }
 
     // Push element
-    void push(int value) {
-        if (isFull()) {
-            cout << "Stack Overflow! Cannot push " << value << endl;
-            return;
-        }
-        arr[++topIndex] = value;
-        cout << "Pushed " << value << " to stack." << endl;
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    // Construct element in place on top; args may refer to an element of
+    // this stack, even when it is full
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (count == cap) return growAndEmplace(std::forward<Args>(args)...);
+        T* slot = new (data + count) T(std::forward<Args>(args)...);
+        count++;
+        return *slot;
     }
 
-    // Pop element
-    int pop() {
-        if (isEmpty()) {
-            cout << "Stack Underflow! Cannot pop." << endl;
-            return -1;
-        }
-        int value = arr[topIndex--];
-        cout << "Popped " << value << " from stack." << endl;
-        return value;
+    // Pop element (precondition: !isEmpty())
+    void pop() {
+        count--;
+        data[count].~T();
     }
 
-    // Peek top element
-    int peek() {
-        if (isEmpty()) {
-            cout << "Stack is empty!" << endl;
-            return -1;
+    // Top element (precondition: !isEmpty())
+    T& top() {
+        return data[count - 1];
+    }
+
+    const T& top() const {
+        return data[count - 1];
+    }
+
+    // Pops into out; returns false if the stack is empty
+    bool tryPop(T& out) {
+        if (count == 0) return false;
+        out = std::move(data[count - 1]);
+        pop();
+        return true;
+    }
+
+    void clear() {
+        if constexpr (!is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < count; i++) {
+                data[i].~T();
+            }
         }
-        return arr[topIndex];
+        count = 0;
     }
 
     // Display stack
-    void display() {
+    void display() const {
         if (isEmpty()) {
             cout << "Stack is empty." << endl;
             return;
         }
         cout << "Stack (top to bottom): ";
-        for (int i = topIndex; i >= 0; i--) {
-            cout << arr[i] << " ";
+        for (size_t i = count; i > 0; i--) {
+            cout << data[i - 1] << " ";
         }
         cout << endl;
     }
@@ -82,37 +221,46 @@ public:
 // ========================================
 
 // Usage: push(stack, value) - pushes value to stack
-void pushElement(Stack& stack, int value) {
+void pushElement(Stack<>& stack, int value) {
     stack.push(value);
 }
 
 // Usage: value = pop(stack) - pops and returns top element
-int popElement(Stack& stack) {
-    return stack.pop();
+int popElement(Stack<>& stack) {
+    int value;
+    if (!stack.tryPop(value)) {
+        cout << "Stack Underflow! Cannot pop." << endl;
+        return -1;
+    }
+    return value;
 }
 
 // Usage: value = peek(stack) - returns top element without removing
-int peekElement(Stack& stack) {
-    return stack.peek();
+int peekElement(Stack<>& stack) {
+    if (stack.isEmpty()) {
+        cout << "Stack is empty!" << endl;
+        return -1;
+    }
+    return stack.top();
 }
 
 // Usage: empty = isEmpty(stack) - checks if stack is empty
-bool isStackEmpty(Stack& stack) {
+bool isStackEmpty(Stack<>& stack) {
     return stack.isEmpty();
 }
 
 // Usage: full = isFull(stack) - checks if stack is full
-bool isStackFull(Stack& stack) {
+bool isStackFull(Stack<>& stack) {
     return stack.isFull();
 }
 
 // Usage: size = getSize(stack) - returns number of elements
-int getSize(Stack& stack) {
-    return stack.size();
+int getSize(Stack<>& stack) {
+    return (int)stack.size();
 }
 
 // Usage: display(stack) - displays all elements
-void displayStack(Stack& stack) {
+void displayStack(Stack<>& stack) {
     stack.display();
 }
 
@@ -121,7 +269,7 @@ void displayStack(Stack& stack) {
 // ========================================
 
 int main() {
-    Stack stack;
+    Stack<> stack;
     
     cout << "=== Stack Basic Operations ===" << endl;
     
@@ -164,5 +312,11 @@ int main() {
     //     cout << "Stack is not full." << endl;
     // }
     
+    // Push the stack's own top (safe even when it must grow)
+    // Stack<string, 4> words;
+    // words.push("top");
+    // for (int i = 0; i < 20; i++) words.push(words.top());
+    // cout << "Copies of top: " << words.size() << endl;
+    
     return 0;
 }
@@ -0,0 +1,417 @@
+#include <iostream>
+#include <stack>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread concurrent_stack.cpp
+
+// ========================================
+// UTILITY FUNCTIONS
+// ========================================
+
+const size_t CACHE_LINE = 64;
+
+// Tell the CPU we are in a spin-wait loop
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    this_thread::yield();
+#endif
+}
+
+// Cheap per-thread random number (xorshift)
+inline uint32_t threadRandom() {
+    static thread_local uint32_t state =
+        (uint32_t)hash<thread::id>()(this_thread::get_id()) | 1;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// ========================================
+// HAZARD POINTERS (SAFE MEMORY RECLAMATION)
+// ========================================
+// Concept: Before dereferencing a shared node, a thread publishes its address
+// in its hazard slot. Removed nodes are not deleted right away but "retired";
+// a retired node is freed only once no hazard slot points at it.
+// - One hazard slot per thread, claimed on first use, released at thread exit
+// - Each thread batches its retired nodes and scans all slots once the batch
+//   reaches RETIRE_THRESHOLD, so the scan cost is amortized
+// - Nodes still hazardous when a thread exits are handed to a shared orphan
+//   list that later scans pick up
+class HazardPointers {
+private:
+    static const int MAX_THREADS = 128;
+    static const size_t RETIRE_THRESHOLD = 2 * MAX_THREADS;
+
+    struct alignas(CACHE_LINE) Record {
+        atomic<const void*> hazard;
+        atomic<bool> owned;
+    };
+
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    struct ThreadState {
+        Record* record = nullptr;
+        vector<Retired> retired;
+
+        ~ThreadState() {
+            if (!retired.empty()) {
+                scan(retired);
+                lock_guard<mutex> lock(orphanMutex);
+                orphans.insert(orphans.end(), retired.begin(), retired.end());
+            }
+            if (record) {
+                record->hazard.store(nullptr, memory_order_release);
+                record->owned.store(false, memory_order_release);
+            }
+        }
+    };
+
+    static inline Record records[MAX_THREADS] = {};
+    static inline mutex orphanMutex;
+    static inline vector<Retired> orphans;
+
+    static ThreadState& state() {
+        static thread_local ThreadState s;
+        return s;
+    }
+
+    static Record* myRecord() {
+        ThreadState& s = state();
+        if (!s.record) {
+            for (int i = 0; i < MAX_THREADS; i++) {
+                bool expected = false;
+                if (!records[i].owned.load(memory_order_relaxed) &&
+                    records[i].owned.compare_exchange_strong(expected, true, memory_order_acq_rel)) {
+                    s.record = &records[i];
+                    break;
+                }
+            }
+            if (!s.record) {
+                cerr << "HazardPointers: more than " << MAX_THREADS << " threads" << endl;
+                terminate();
+            }
+        }
+        return s.record;
+    }
+
+    // Free every node in list that no thread currently protects
+    static void scan(vector<Retired>& list) {
+        vector<const void*> hazards;
+        hazards.reserve(MAX_THREADS);
+        atomic_thread_fence(memory_order_seq_cst);
+        for (int i = 0; i < MAX_THREADS; i++) {
+            const void* p = records[i].hazard.load(memory_order_acquire);
+            if (p) hazards.push_back(p);
+        }
+        sort(hazards.begin(), hazards.end());
+
+        size_t kept = 0;
+        for (size_t i = 0; i < list.size(); i++) {
+            if (binary_search(hazards.begin(), hazards.end(), (const void*)list[i].ptr)) {
+                list[kept++] = list[i];
+            } else {
+                list[i].deleter(list[i].ptr);
+            }
+        }
+        list.resize(kept);
+    }
+
+public:
+    // Publish p as in use by this thread. The caller must re-validate that
+    // p is still reachable afterwards before dereferencing it.
+    static void protect(const void* p) {
+        myRecord()->hazard.store(p, memory_order_seq_cst);
+    }
+
+    static void clear() {
+        myRecord()->hazard.store(nullptr, memory_order_release);
+    }
+
+    template <typename T>
+    static void retire(T* p) {
+        vector<Retired>& list = state().retired;
+        list.push_back({p, [](void* q) { delete static_cast<T*>(q); }});
+        if (list.size() >= RETIRE_THRESHOLD) {
+            {
+                lock_guard<mutex> lock(orphanMutex);
+                list.insert(list.end(), orphans.begin(), orphans.end());
+                orphans.clear();
+            }
+            scan(list);
+        }
+    }
+};
+
+// ========================================
+// LOCK-FREE TREIBER STACK
+// ========================================
+// Concept: Singly linked list whose head is swung with compare-and-swap
+// - ABA: the head word packs a 16-bit version tag into the unused upper
+//   bits of the 48-bit x86-64 / AArch64 user-space pointer; every
+//   successful CAS bumps the tag
+// - Reclamation: pop protects the head node with a hazard pointer before
+//   reading head->next, and retires popped nodes instead of deleting them
+// - Elimination backoff: when the head CAS fails under contention, a push
+//   parks its node in a random exchange slot where a concurrent pop can take
+//   it directly, so the pair completes without touching the head
+// Usage: LockFreeStack<int> st; st.push(x); st.tryPop(x);
+template <typename T>
+class LockFreeStack {
+private:
+    struct Node {
+        T value;
+        Node* next;
+
+        template <typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
+    };
+
+    static_assert(sizeof(void*) == 8, "LockFreeStack packs a tag into 64-bit pointers");
+    static const int TAG_SHIFT = 48;
+    static const uint64_t PTR_MASK = (1ULL << TAG_SHIFT) - 1;
+
+    static Node* ptrOf(uint64_t word) { return reinterpret_cast<Node*>(word & PTR_MASK); }
+    static uint64_t tagOf(uint64_t word) { return word >> TAG_SHIFT; }
+    static uint64_t pack(Node* p, uint64_t tag) {
+        return reinterpret_cast<uint64_t>(p) | (tag << TAG_SHIFT);
+    }
+
+    // Exchange slots: each holds a tagged Node* (null = empty)
+    static const int ELIMINATION_SLOTS = 16;
+    static const int ELIMINATION_SPINS = 128;
+
+    struct alignas(CACHE_LINE) ExchangeSlot {
+        atomic<uint64_t> word;
+    };
+
+    alignas(CACHE_LINE) atomic<uint64_t> head;
+    ExchangeSlot slots[ELIMINATION_SLOTS];
+    bool useElimination;
+
+    // Park node in a random slot; returns true if a pop took it
+    bool tryEliminatePush(Node* node) {
+        ExchangeSlot& slot = slots[threadRandom() % ELIMINATION_SLOTS];
+        uint64_t empty = slot.word.load(memory_order_relaxed);
+        if (ptrOf(empty) != nullptr) return false;
+        uint64_t offered = pack(node, tagOf(empty) + 1);
+        if (!slot.word.compare_exchange_strong(empty, offered, memory_order_release)) {
+            return false;
+        }
+        for (int i = 0; i < ELIMINATION_SPINS; i++) {
+            if (slot.word.load(memory_order_relaxed) != offered) return true;
+            cpuRelax();
+        }
+        // Withdraw the offer; failure means a pop took the node meanwhile
+        uint64_t withdrawn = pack(nullptr, tagOf(offered) + 1);
+        return !slot.word.compare_exchange_strong(offered, withdrawn, memory_order_acquire);
+    }
+
+    // Take a parked node from a random slot, or nullptr if none
+    Node* tryEliminatePop() {
+        ExchangeSlot& slot = slots[threadRandom() % ELIMINATION_SLOTS];
+        for (int i = 0; i < ELIMINATION_SPINS / 8; i++) {
+            uint64_t word = slot.word.load(memory_order_acquire);
+            Node* node = ptrOf(word);
+            if (node) {
+                uint64_t taken = pack(nullptr, tagOf(word) + 1);
+                if (slot.word.compare_exchange_strong(word, taken, memory_order_acquire)) {
+                    return node;
+                }
+            }
+            cpuRelax();
+        }
+        return nullptr;
+    }
+
+    void pushNode(Node* node) {
+        uint64_t old = head.load(memory_order_relaxed);
+        while (true) {
+            node->next = ptrOf(old);
+            if (head.compare_exchange_weak(old, pack(node, tagOf(old) + 1),
+                                           memory_order_release, memory_order_relaxed)) {
+                return;
+            }
+            if (useElimination && tryEliminatePush(node)) return;
+            old = head.load(memory_order_relaxed);
+        }
+    }
+
+public:
+    explicit LockFreeStack(bool elimination = true) : head(0), useElimination(elimination) {
+        for (ExchangeSlot& slot : slots) {
+            slot.word.store(0, memory_order_relaxed);
+        }
+    }
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    // Must not race with other operations
+    ~LockFreeStack() {
+        Node* node = ptrOf(head.load(memory_order_relaxed));
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    void push(const T& value) { pushNode(new Node(value)); }
+    void push(T&& value) { pushNode(new Node(std::move(value))); }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        pushNode(new Node(std::forward<Args>(args)...));
+    }
+
+    // Pops into out; returns false if the stack is empty
+    bool tryPop(T& out) {
+        while (true) {
+            uint64_t old = head.load(memory_order_acquire);
+            Node* node = ptrOf(old);
+            if (!node) {
+                HazardPointers::clear();
+                return false;
+            }
+            HazardPointers::protect(node);
+            if (head.load(memory_order_acquire) != old) continue;
+
+            uint64_t next = pack(node->next, tagOf(old) + 1);
+            if (head.compare_exchange_strong(old, next, memory_order_acquire, memory_order_relaxed)) {
+                HazardPointers::clear();
+                out = std::move(node->value);
+                HazardPointers::retire(node);
+                return true;
+            }
+
+            if (useElimination) {
+                HazardPointers::clear();
+                // A node handed over through a slot was never visible on the
+                // stack, so no other thread can hold a reference to it
+                Node* handed = tryEliminatePop();
+                if (handed) {
+                    out = std::move(handed->value);
+                    delete handed;
+                    return true;
+                }
+            }
+        }
+    }
+
+    // Snapshot; may be stale by the time it returns
+    bool isEmpty() const {
+        return ptrOf(head.load(memory_order_acquire)) == nullptr;
+    }
+};
+
+// ========================================
+// MUTEX-WRAPPED STACK (BASELINE)
+// ========================================
+template <typename T>
+class LockedStack {
+private:
+    stack<T> st;
+    mutex m;
+
+public:
+    void push(const T& value) {
+        lock_guard<mutex> lock(m);
+        st.push(value);
+    }
+
+    bool tryPop(T& out) {
+        lock_guard<mutex> lock(m);
+        if (st.empty()) return false;
+        out = std::move(st.top());
+        st.pop();
+        return true;
+    }
+};
+
+// ========================================
+// BENCHMARK: CONTENTION
+// ========================================
+// Usage: benchmarkConcurrentStack(opsPerThread, maxThreads)
+// Example: benchmarkConcurrentStack(1000000, 8) - every thread alternates
+// push/pop pairs (the free-list pattern); reports total M ops/s for
+// 1..maxThreads threads
+template <typename S>
+double stackThroughput(S& st, int threads, long long opsPerThread) {
+    atomic<long long> popped(0);
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            long long value, local = 0;
+            for (long long i = 0; i < opsPerThread; i++) {
+                st.push(t * opsPerThread + i);
+                if (st.tryPop(value)) local++;
+            }
+            popped.fetch_add(local, memory_order_relaxed);
+        });
+    }
+    for (thread& w : workers) w.join();
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return 2.0 * threads * opsPerThread / secs / 1e6;
+}
+
+void benchmarkConcurrentStack(long long opsPerThread, int maxThreads) {
+    cout << "Hardware threads: " << thread::hardware_concurrency() << endl;
+    cout << "threads   mutex(Mops/s)   treiber(Mops/s)   treiber+elim(Mops/s)" << endl;
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        LockedStack<long long> locked;
+        LockFreeStack<long long> plain(false), eliminating(true);
+        double lockedRate = stackThroughput(locked, t, opsPerThread);
+        double plainRate = stackThroughput(plain, t, opsPerThread);
+        double elimRate = stackThroughput(eliminating, t, opsPerThread);
+        cout << t << "   " << lockedRate << "   " << plainRate << "   " << elimRate << endl;
+    }
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Concurrent Stack ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // Shared free-list across threads
+    // LockFreeStack<int> freeList;
+    // vector<thread> threads;
+    // for (int t = 0; t < 4; t++) {
+    //     threads.emplace_back([&, t] {
+    //         for (int i = 0; i < 5; i++) freeList.push(t * 10 + i);
+    //     });
+    // }
+    // for (thread& th : threads) th.join();
+    // int value;
+    // cout << "Popped: ";
+    // while (freeList.tryPop(value)) cout << value << " ";
+    // cout << endl;
+
+    // Contention benchmark against mutex + std::stack
+    // benchmarkConcurrentStack(1000000, 8);
+
+    return 0;
+}
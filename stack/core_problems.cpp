@@ -2,6 +2,9 @@
 #include <stack>
 #include <string>
 #include <algorithm>
+#include <memory>
+#include <utility>
+#include <type_traits>
 using namespace std;
 
 // ========================================
@@ -263,58 +266,141 @@ void reverseStack(stack<int>& st) {
 // ========================================
 // 10. IMPLEMENT TWO STACKS IN ONE ARRAY
 // ========================================
+// Concept: Stack1 grows up from the front, stack2 grows down from the back.
+// When they meet, the shared buffer doubles and stack2 is moved to the new end.
+// One buffer serves both stacks, so this keeps its own storage rather than
+// wrapping two Stack<T> objects (two objects would mean two buffers).
+// pop1()/pop2() report underflow like the array version; tryPop1/tryPop2
+// are the silent, checked form.
+template <typename T = int>
 class TwoStacks {
 private:
-    int* arr;
-    int size;
-    int top1, top2;
+    T* arr;
+    size_t cap;
+    size_t count1;  // Stack1 occupies arr[0, count1)
+    size_t count2;  // Stack2 occupies arr[cap - count2, cap)
 
-public:
-    TwoStacks(int n) {
-        size = n;
-        arr = new int[n];
-        top1 = -1;
-        top2 = size;
-    }
-    
-    void push1(int value) {
-        if (top1 < top2 - 1) {
-            arr[++top1] = value;
-            cout << "Pushed " << value << " to stack1." << endl;
-        } else {
-            cout << "Stack Overflow!" << endl;
+    // Slow path of a push on a full buffer. The new element is built in
+    // the new buffer before the old elements move, so args may refer to
+    // an element of either stack (e.g. ts.push2(ts.top1()))
+    template <typename... Args>
+    T& growAndEmplace(bool second, Args&&... args) {
+        size_t newCap = cap < 4 ? 8 : cap * 2;
+        T* newArr = allocator<T>().allocate(newCap);
+        T* slot = second ? newArr + newCap - count2 - 1 : newArr + count1;
+        try {
+            new (slot) T(std::forward<Args>(args)...);
+        } catch (...) {
+            allocator<T>().deallocate(newArr, newCap);
+            throw;
         }
+        for (size_t i = 0; i < count1; i++) {
+            new (newArr + i) T(std::move(arr[i]));
+            arr[i].~T();
+        }
+        for (size_t i = 0; i < count2; i++) {
+            T& src = arr[cap - count2 + i];
+            new (newArr + newCap - count2 + i) T(std::move(src));
+            src.~T();
+        }
+        if (arr) allocator<T>().deallocate(arr, cap);
+        arr = newArr;
+        cap = newCap;
+        (second ? count2 : count1)++;
+        return *slot;
     }
-    
-    void push2(int value) {
-        if (top1 < top2 - 1) {
-            arr[--top2] = value;
-            cout << "Pushed " << value << " to stack2." << endl;
-        } else {
-            cout << "Stack Overflow!" << endl;
+
+    // What pop1()/pop2() return on underflow: -1 as before, for numbers
+    static T underflowValue() {
+        if constexpr (is_constructible<T, int>::value) return T(-1);
+        else return T();
+    }
+
+public:
+    explicit TwoStacks(size_t initialCapacity = 8)
+        : arr(nullptr), cap(0), count1(0), count2(0) {
+        if (initialCapacity > 0) {
+            arr = allocator<T>().allocate(initialCapacity);
+            cap = initialCapacity;
         }
     }
-    
-    int pop1() {
-        if (top1 >= 0) {
-            return arr[top1--];
-        } else {
+
+    TwoStacks(const TwoStacks&) = delete;
+    TwoStacks& operator=(const TwoStacks&) = delete;
+
+    void push1(const T& value) { emplace1(value); }
+    void push1(T&& value) { emplace1(std::move(value)); }
+    void push2(const T& value) { emplace2(value); }
+    void push2(T&& value) { emplace2(std::move(value)); }
+
+    template <typename... Args>
+    T& emplace1(Args&&... args) {
+        if (count1 + count2 == cap) return growAndEmplace(false, std::forward<Args>(args)...);
+        T* slot = new (arr + count1) T(std::forward<Args>(args)...);
+        count1++;
+        return *slot;
+    }
+
+    template <typename... Args>
+    T& emplace2(Args&&... args) {
+        if (count1 + count2 == cap) return growAndEmplace(true, std::forward<Args>(args)...);
+        T* slot = new (arr + cap - count2 - 1) T(std::forward<Args>(args)...);
+        count2++;
+        return *slot;
+    }
+
+    bool isEmpty1() const { return count1 == 0; }
+    bool isEmpty2() const { return count2 == 0; }
+    size_t size1() const { return count1; }
+    size_t size2() const { return count2; }
+
+    // Precondition: !isEmpty1() / !isEmpty2()
+    T& top1() { return arr[count1 - 1]; }
+    T& top2() { return arr[cap - count2]; }
+
+    // Pops into out; returns false if that stack is empty
+    bool tryPop1(T& out) {
+        if (count1 == 0) return false;
+        out = std::move(arr[count1 - 1]);
+        arr[--count1].~T();
+        return true;
+    }
+
+    bool tryPop2(T& out) {
+        if (count2 == 0) return false;
+        T& slot = arr[cap - count2];
+        out = std::move(slot);
+        slot.~T();
+        count2--;
+        return true;
+    }
+
+    T pop1() {
+        if (count1 == 0) {
             cout << "Stack1 Underflow!" << endl;
-            return -1;
+            return underflowValue();
         }
+        T value = std::move(arr[count1 - 1]);
+        arr[--count1].~T();
+        return value;
     }
-    
-    int pop2() {
-        if (top2 < size) {
-            return arr[top2++];
-        } else {
+
+    T pop2() {
+        if (count2 == 0) {
             cout << "Stack2 Underflow!" << endl;
-            return -1;
+            return underflowValue();
         }
+        T& slot = arr[cap - count2];
+        T value = std::move(slot);
+        slot.~T();
+        count2--;
+        return value;
     }
-    
+
     ~TwoStacks() {
-        delete[] arr;
+        for (size_t i = 0; i < count1; i++) arr[i].~T();
+        for (size_t i = cap - count2; i < cap; i++) arr[i].~T();
+        if (arr) allocator<T>().deallocate(arr, cap);
     }
 };
 
@@ -391,11 +477,12 @@ int main() {
     // cout << endl;
     
     // 10. Two Stacks in One Array
-    // TwoStacks ts(10);
+    // TwoStacks<int> ts(4);
     // ts.push1(5);
     // ts.push2(10);
     // ts.push1(15);
     // ts.push2(20);
+    // ts.push1(25);  // Buffer grows instead of overflowing
     // cout << "Popped from stack1: " << ts.pop1() << endl;
     // cout << "Popped from stack2: " << ts.pop2() << endl;
     
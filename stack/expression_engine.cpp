@@ -0,0 +1,739 @@
+#include <iostream>
+#include <stack>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <memory>
+#include <chrono>
+#include <cctype>
+#include <cstdint>
+#include <climits>
+using namespace std;
+
+// ========================================
+// EXPRESSION ENGINE
+// ========================================
+// Concept: Compile once, evaluate many times
+// - Tokenizer walks a string_view; numbers and identifiers are never copied
+// - Shunting-yard turns infix into an RPN program, using an operator
+//   buffer that is allocated once per thread and reused
+// - The compiler tracks the maximum value-stack depth, so evaluation runs
+//   on a fixed buffer with no allocation
+// - Programs are cached by their source text, and one program can be run
+//   over a whole batch of variable bindings
+//
+// Grammar: integers, identifiers (variables), + - * / ^, unary -, ( )
+// Semantics: 64-bit integer arithmetic that wraps on overflow, '/'
+// truncates toward zero, division by zero and LLONG_MIN / -1 yield 0, '^'
+// is right-associative, negative exponents yield 0 (except for bases 1
+// and -1). Literals outside the long long range are compile errors. In
+// RPN text a sign directly followed by a digit is part of the number
+// ("1 -2 +" is 1 + -2), as with evalRPN's stoi.
+
+enum class OpCode : uint8_t {
+    PUSH_CONST,
+    PUSH_VAR,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    NEG
+};
+
+struct Instruction {
+    OpCode op;
+    long long operand;  // Constant value or variable slot
+};
+
+struct RPNProgram {
+    string source;
+    vector<Instruction> code;
+    vector<string> variables;  // Slot i binds to variables[i]
+    int maxDepth = 0;
+    bool ok = false;
+    string error;
+
+    // Slot for a variable name, or -1 if the program does not use it
+    int slotOf(string_view name) const {
+        for (size_t i = 0; i < variables.size(); i++) {
+            if (variables[i] == name) return (int)i;
+        }
+        return -1;
+    }
+};
+
+// ========================================
+// 1. TOKENIZER
+// ========================================
+enum class TokenType { NUMBER, IDENTIFIER, OPERATOR, LEFT_PAREN, RIGHT_PAREN, END, INVALID, OUT_OF_RANGE };
+
+struct Token {
+    TokenType type;
+    string_view text;
+    long long value;
+};
+
+// signedNumbers: read "-2" / "+2" (sign directly followed by a digit) as
+// one NUMBER token. Only RPN wants this; in infix "1-2" is a subtraction.
+class Tokenizer {
+private:
+    string_view src;
+    size_t pos;
+    bool signedNumbers;
+
+public:
+    explicit Tokenizer(string_view s, bool signedNumbers = false) : src(s), pos(0), signedNumbers(signedNumbers) {}
+
+    Token next() {
+        while (pos < src.size() && isspace((unsigned char)src[pos])) pos++;
+        if (pos >= src.size()) return {TokenType::END, {}, 0};
+
+        size_t start = pos;
+        unsigned char ch = src[pos];
+
+        bool negative = false;
+        if (signedNumbers && (ch == '-' || ch == '+') && pos + 1 < src.size() &&
+            isdigit((unsigned char)src[pos + 1])) {
+            negative = ch == '-';
+            ch = src[++pos];
+        }
+        if (isdigit(ch)) {
+            // Magnitude in unsigned, so LLONG_MIN itself is representable
+            unsigned long long limit = negative ? (unsigned long long)LLONG_MAX + 1 : LLONG_MAX;
+            unsigned long long magnitude = 0;
+            bool inRange = true;
+            while (pos < src.size() && isdigit((unsigned char)src[pos])) {
+                unsigned digit = src[pos] - '0';
+                if (magnitude > (limit - digit) / 10) inRange = false;
+                else magnitude = magnitude * 10 + digit;
+                pos++;
+            }
+            string_view text = src.substr(start, pos - start);
+            if (!inRange) return {TokenType::OUT_OF_RANGE, text, 0};
+            long long value = negative && magnitude ? -(long long)(magnitude - 1) - 1 : (long long)magnitude;
+            return {TokenType::NUMBER, text, value};
+        }
+        if (isalpha(ch) || ch == '_') {
+            while (pos < src.size() && (isalnum((unsigned char)src[pos]) || src[pos] == '_')) pos++;
+            return {TokenType::IDENTIFIER, src.substr(start, pos - start), 0};
+        }
+
+        pos++;
+        switch (ch) {
+            case '(': return {TokenType::LEFT_PAREN, src.substr(start, 1), 0};
+            case ')': return {TokenType::RIGHT_PAREN, src.substr(start, 1), 0};
+            case '+': case '-': case '*': case '/': case '^':
+                return {TokenType::OPERATOR, src.substr(start, 1), 0};
+            default:
+                return {TokenType::INVALID, src.substr(start, 1), 0};
+        }
+    }
+};
+
+// ========================================
+// 2. COMPILER (SHUNTING-YARD)
+// ========================================
+// Operator stack entries: the opcode, or LEFT_PAREN_MARK for '('
+const uint8_t LEFT_PAREN_MARK = 0xFF;
+
+int opPrecedence(OpCode op) {
+    switch (op) {
+        case OpCode::ADD: case OpCode::SUB: return 1;
+        case OpCode::MUL: case OpCode::DIV: return 2;
+        case OpCode::NEG: return 3;
+        case OpCode::POW: return 4;
+        default: return 0;
+    }
+}
+
+bool isRightAssociative(OpCode op) {
+    return op == OpCode::POW || op == OpCode::NEG;
+}
+
+OpCode binaryOpFor(char ch) {
+    switch (ch) {
+        case '+': return OpCode::ADD;
+        case '-': return OpCode::SUB;
+        case '*': return OpCode::MUL;
+        case '/': return OpCode::DIV;
+        default: return OpCode::POW;
+    }
+}
+
+// Appends an instruction and tracks the value-stack depth.
+// Returns false if an operator would not have enough operands.
+bool emit(RPNProgram& prog, int& depth, OpCode op, long long operand = 0) {
+    switch (op) {
+        case OpCode::PUSH_CONST:
+        case OpCode::PUSH_VAR:
+            depth++;
+            break;
+        case OpCode::NEG:
+            if (depth < 1) return false;
+            break;
+        default:
+            if (depth < 2) return false;
+            depth--;
+            break;
+    }
+    if (depth > prog.maxDepth) prog.maxDepth = depth;
+    prog.code.push_back({op, operand});
+    return true;
+}
+
+int variableSlot(RPNProgram& prog, string_view name) {
+    int slot = prog.slotOf(name);
+    if (slot >= 0) return slot;
+    prog.variables.emplace_back(name);
+    return (int)prog.variables.size() - 1;
+}
+
+bool failCompile(RPNProgram& prog, const string& message) {
+    prog.ok = false;
+    prog.error = message;
+    prog.code.clear();
+    return false;
+}
+
+// Usage: ok = compileInfix("a*x^2 + b*x + c", prog)
+// Example: compileInfix("(1+(4+5+2)-3)+(6+8)", prog) then runProgram(prog) returns 23
+bool compileInfix(string_view expr, RPNProgram& prog) {
+    // Operator buffer shared by every compile on this thread
+    static thread_local vector<uint8_t> ops;
+    ops.clear();
+    if (ops.capacity() < expr.size()) ops.reserve(expr.size());
+
+    prog.source.assign(expr.data(), expr.size());
+    prog.code.clear();
+    prog.code.reserve(expr.size());
+    prog.variables.clear();
+    prog.maxDepth = 0;
+    prog.error.clear();
+
+    int depth = 0;
+    bool expectOperand = true;  // True at start, after '(' and after an operator
+    Tokenizer tokenizer(expr);
+
+    // Pop operators that bind at least as tightly as op
+    auto popWhileHigher = [&](OpCode op) {
+        while (!ops.empty() && ops.back() != LEFT_PAREN_MARK) {
+            OpCode top = (OpCode)ops.back();
+            int pTop = opPrecedence(top), pOp = opPrecedence(op);
+            if (pTop > pOp || (pTop == pOp && !isRightAssociative(op))) {
+                if (!emit(prog, depth, top)) return false;
+                ops.pop_back();
+            } else {
+                break;
+            }
+        }
+        return true;
+    };
+
+    for (Token tok = tokenizer.next(); tok.type != TokenType::END; tok = tokenizer.next()) {
+        switch (tok.type) {
+            case TokenType::OUT_OF_RANGE:
+                return failCompile(prog, "number out of range '" + string(tok.text) + "'");
+
+            case TokenType::NUMBER:
+                if (!expectOperand) return failCompile(prog, "unexpected number");
+                emit(prog, depth, OpCode::PUSH_CONST, tok.value);
+                expectOperand = false;
+                break;
+
+            case TokenType::IDENTIFIER:
+                if (!expectOperand) return failCompile(prog, "unexpected identifier");
+                emit(prog, depth, OpCode::PUSH_VAR, variableSlot(prog, tok.text));
+                expectOperand = false;
+                break;
+
+            case TokenType::LEFT_PAREN:
+                if (!expectOperand) return failCompile(prog, "unexpected '('");
+                ops.push_back(LEFT_PAREN_MARK);
+                break;
+
+            case TokenType::RIGHT_PAREN:
+                if (expectOperand) return failCompile(prog, "unexpected ')'");
+                while (!ops.empty() && ops.back() != LEFT_PAREN_MARK) {
+                    emit(prog, depth, (OpCode)ops.back());
+                    ops.pop_back();
+                }
+                if (ops.empty()) return failCompile(prog, "unbalanced ')'");
+                ops.pop_back();
+                break;
+
+            case TokenType::OPERATOR:
+                if (expectOperand) {
+                    // Prefix position: only '-' (negate) and '+' (no-op) allowed
+                    if (tok.text[0] == '-') ops.push_back((uint8_t)OpCode::NEG);
+                    else if (tok.text[0] != '+') return failCompile(prog, "missing operand");
+                } else {
+                    OpCode op = binaryOpFor(tok.text[0]);
+                    if (!popWhileHigher(op)) return failCompile(prog, "missing operand");
+                    ops.push_back((uint8_t)op);
+                    expectOperand = true;
+                }
+                break;
+
+            default:
+                return failCompile(prog, "invalid character '" + string(tok.text) + "'");
+        }
+    }
+
+    if (expectOperand) return failCompile(prog, "missing operand");
+    while (!ops.empty()) {
+        if (ops.back() == LEFT_PAREN_MARK) return failCompile(prog, "unbalanced '('");
+        if (!emit(prog, depth, (OpCode)ops.back())) return failCompile(prog, "missing operand");
+        ops.pop_back();
+    }
+    if (depth != 1) return failCompile(prog, "malformed expression");
+
+    prog.ok = true;
+    return true;
+}
+
+// Usage: ok = compileRPN("2 1 + 3 *", prog) - whitespace-separated postfix tokens
+// Example: compileRPN("2 1 + 3 *", prog) then runProgram(prog) returns 9
+bool compileRPN(string_view expr, RPNProgram& prog) {
+    prog.source.assign(expr.data(), expr.size());
+    prog.code.clear();
+    prog.code.reserve(expr.size() / 2 + 1);
+    prog.variables.clear();
+    prog.maxDepth = 0;
+    prog.error.clear();
+
+    int depth = 0;
+    Tokenizer tokenizer(expr, true);
+    for (Token tok = tokenizer.next(); tok.type != TokenType::END; tok = tokenizer.next()) {
+        bool good = true;
+        if (tok.type == TokenType::OUT_OF_RANGE) {
+            return failCompile(prog, "number out of range '" + string(tok.text) + "'");
+        } else if (tok.type == TokenType::NUMBER) {
+            good = emit(prog, depth, OpCode::PUSH_CONST, tok.value);
+        } else if (tok.type == TokenType::IDENTIFIER) {
+            good = emit(prog, depth, OpCode::PUSH_VAR, variableSlot(prog, tok.text));
+        } else if (tok.type == TokenType::OPERATOR) {
+            good = emit(prog, depth, binaryOpFor(tok.text[0]));
+        } else {
+            return failCompile(prog, "unexpected token '" + string(tok.text) + "'");
+        }
+        if (!good) return failCompile(prog, "missing operand");
+    }
+    if (depth != 1) return failCompile(prog, "malformed expression");
+
+    prog.ok = true;
+    return true;
+}
+
+// ========================================
+// 3. EVALUATOR
+// ========================================
+// +, -, * and negate wrap modulo 2^64 (done in unsigned, where
+// overflow is defined) instead of being signed-overflow UB
+inline long long wrapAdd(long long a, long long b) {
+    return (long long)((unsigned long long)a + (unsigned long long)b);
+}
+
+inline long long wrapSub(long long a, long long b) {
+    return (long long)((unsigned long long)a - (unsigned long long)b);
+}
+
+inline long long wrapMul(long long a, long long b) {
+    return (long long)((unsigned long long)a * (unsigned long long)b);
+}
+
+inline long long wrapNeg(long long a) {
+    return (long long)(0 - (unsigned long long)a);
+}
+
+// Both cases the hardware cannot do (x / 0 and LLONG_MIN / -1) yield 0
+inline long long applyDiv(long long a, long long b) {
+    return b == 0 || (b == -1 && a == LLONG_MIN) ? 0 : a / b;
+}
+
+inline long long applyPow(long long base, long long exp) {
+    if (exp < 0) return base == 1 ? 1 : (base == -1 ? (exp % 2 ? -1 : 1) : 0);
+    long long result = 1;
+    while (exp > 0) {
+        if (exp & 1) result = wrapMul(result, base);
+        base = wrapMul(base, base);
+        exp >>= 1;
+    }
+    return result;
+}
+
+// Usage: value = runProgram(prog, vars) - vars[i] binds prog.variables[i]
+// Example: runProgram(prog) for a program without variables
+// Returns 0 for a program that failed to compile (or needs vars and got none)
+long long runProgram(const RPNProgram& prog, const long long* vars = nullptr) {
+    if (!prog.ok || (!vars && !prog.variables.empty())) return 0;
+    const int INLINE_DEPTH = 64;
+    long long inlineStack[INLINE_DEPTH];
+    static thread_local vector<long long> bigStack;
+    long long* st = inlineStack;
+    if (prog.maxDepth > INLINE_DEPTH) {
+        if ((int)bigStack.size() < prog.maxDepth) bigStack.resize(prog.maxDepth);
+        st = bigStack.data();
+    }
+
+    int sp = 0;
+    for (const Instruction& ins : prog.code) {
+        switch (ins.op) {
+            case OpCode::PUSH_CONST: st[sp++] = ins.operand; break;
+            case OpCode::PUSH_VAR:   st[sp++] = vars[ins.operand]; break;
+            case OpCode::ADD: sp--; st[sp - 1] = wrapAdd(st[sp - 1], st[sp]); break;
+            case OpCode::SUB: sp--; st[sp - 1] = wrapSub(st[sp - 1], st[sp]); break;
+            case OpCode::MUL: sp--; st[sp - 1] = wrapMul(st[sp - 1], st[sp]); break;
+            case OpCode::DIV: sp--; st[sp - 1] = applyDiv(st[sp - 1], st[sp]); break;
+            case OpCode::POW: sp--; st[sp - 1] = applyPow(st[sp - 1], st[sp]); break;
+            case OpCode::NEG: st[sp - 1] = wrapNeg(st[sp - 1]); break;
+        }
+    }
+    return st[0];
+}
+
+// Evaluate one program over many rows of bindings.
+// bindings is row-major: row r binds variable i to bindings[r * numVars + i].
+// Rows are processed in blocks, one instruction at a time across the whole
+// block, so the per-instruction dispatch is paid once per block and the
+// arithmetic loops vectorize.
+// Usage: runBatch(prog, bindings, rows, results)
+// A program that failed to compile gives 0 for every row, like runProgram.
+void runBatch(const RPNProgram& prog, const long long* bindings, size_t rows, long long* results) {
+    if (!prog.ok || (!bindings && !prog.variables.empty())) {
+        fill(results, results + rows, 0LL);
+        return;
+    }
+    const size_t BLOCK = 256;
+    const size_t numVars = prog.variables.size();
+    static thread_local vector<long long> columns;
+    if (columns.size() < (size_t)prog.maxDepth * BLOCK) columns.resize((size_t)prog.maxDepth * BLOCK);
+
+    for (size_t base = 0; base < rows; base += BLOCK) {
+        size_t n = min(BLOCK, rows - base);
+        int sp = 0;
+        for (const Instruction& ins : prog.code) {
+            size_t topIndex = sp > 0 ? (size_t)sp - 1 : 0;
+            long long* top = columns.data() + topIndex * BLOCK;
+            long long* below = columns.data() + (topIndex > 0 ? topIndex - 1 : 0) * BLOCK;
+            switch (ins.op) {
+                case OpCode::PUSH_CONST: {
+                    long long* col = columns.data() + (size_t)sp++ * BLOCK;
+                    for (size_t i = 0; i < n; i++) col[i] = ins.operand;
+                    break;
+                }
+                case OpCode::PUSH_VAR: {
+                    long long* col = columns.data() + (size_t)sp++ * BLOCK;
+                    const long long* src = bindings + base * numVars + ins.operand;
+                    for (size_t i = 0; i < n; i++) col[i] = src[i * numVars];
+                    break;
+                }
+                case OpCode::ADD: for (size_t i = 0; i < n; i++) below[i] = wrapAdd(below[i], top[i]); sp--; break;
+                case OpCode::SUB: for (size_t i = 0; i < n; i++) below[i] = wrapSub(below[i], top[i]); sp--; break;
+                case OpCode::MUL: for (size_t i = 0; i < n; i++) below[i] = wrapMul(below[i], top[i]); sp--; break;
+                case OpCode::DIV:
+                    for (size_t i = 0; i < n; i++) below[i] = applyDiv(below[i], top[i]);
+                    sp--;
+                    break;
+                case OpCode::POW:
+                    for (size_t i = 0; i < n; i++) below[i] = applyPow(below[i], top[i]);
+                    sp--;
+                    break;
+                case OpCode::NEG: for (size_t i = 0; i < n; i++) top[i] = wrapNeg(top[i]); break;
+            }
+        }
+        for (size_t i = 0; i < n; i++) results[base + i] = columns[i];
+    }
+}
+
+// ========================================
+// 4. COMPILED-PROGRAM CACHE
+// ========================================
+// Concept: Map expression text -> compiled program
+// Keys are string_views into each program's own source string, so a lookup
+// with a string_view allocates nothing. When full, the cache is flushed,
+// which invalidates previously returned pointers.
+// Usage: ExpressionCache cache; const RPNProgram* p = cache.getInfix("1+2");
+class ExpressionCache {
+private:
+    unordered_map<string_view, unique_ptr<RPNProgram>> infixPrograms;
+    unordered_map<string_view, unique_ptr<RPNProgram>> rpnPrograms;
+    size_t maxEntries;
+
+    const RPNProgram* lookup(unordered_map<string_view, unique_ptr<RPNProgram>>& table,
+                             string_view expr, bool (*compile)(string_view, RPNProgram&)) {
+        auto it = table.find(expr);
+        if (it != table.end()) return it->second.get();
+
+        if (table.size() >= maxEntries) table.clear();
+        unique_ptr<RPNProgram> prog(new RPNProgram());
+        compile(expr, *prog);
+        string_view key = prog->source;
+        RPNProgram* raw = prog.get();
+        table.emplace(key, std::move(prog));
+        return raw;
+    }
+
+public:
+    explicit ExpressionCache(size_t maxEntries = 100000) : maxEntries(maxEntries) {}
+
+    // Compiled program for an infix expression (check ->ok before running)
+    const RPNProgram* getInfix(string_view expr) {
+        return lookup(infixPrograms, expr, compileInfix);
+    }
+
+    // Compiled program for a whitespace-separated RPN expression
+    const RPNProgram* getRPN(string_view expr) {
+        return lookup(rpnPrograms, expr, compileRPN);
+    }
+
+    size_t size() const {
+        return infixPrograms.size() + rpnPrograms.size();
+    }
+};
+
+// Usage: value = evaluateInfix(cache, "(1+(4+5+2)-3)+(6+8)")
+// Example: returns 23; malformed expressions return 0
+long long evaluateInfix(ExpressionCache& cache, string_view expr, const long long* vars = nullptr) {
+    const RPNProgram* prog = cache.getInfix(expr);
+    return prog->ok ? runProgram(*prog, vars) : 0;
+}
+
+// Usage: value = evaluateRPN(cache, "2 1 + 3 *")
+// Example: returns 9; malformed expressions return 0
+long long evaluateRPN(ExpressionCache& cache, string_view expr) {
+    const RPNProgram* prog = cache.getRPN(expr);
+    return prog->ok ? runProgram(*prog) : 0;
+}
+
+// ========================================
+// BASELINE (copies of the stack/ functions, for the benchmark)
+// ========================================
+// From stack/core_problems.cpp
+int precedence(char op) {
+    if (op == '+' || op == '-') return 1;
+    if (op == '*' || op == '/') return 2;
+    if (op == '^') return 3;
+    return 0;
+}
+
+string infixToPostfix(string infix) {
+    stack<char> st;
+    string postfix = "";
+    for (char ch : infix) {
+        if (isalnum(ch)) {
+            postfix += ch;
+        } else if (ch == '(') {
+            st.push(ch);
+        } else if (ch == ')') {
+            while (!st.empty() && st.top() != '(') {
+                postfix += st.top();
+                st.pop();
+            }
+            if (!st.empty()) st.pop();
+        } else {
+            while (!st.empty() && precedence(st.top()) >= precedence(ch)) {
+                postfix += st.top();
+                st.pop();
+            }
+            st.push(ch);
+        }
+    }
+    while (!st.empty()) {
+        postfix += st.top();
+        st.pop();
+    }
+    return postfix;
+}
+
+int evaluatePostfix(string postfix) {
+    stack<int> st;
+    for (char ch : postfix) {
+        if (isdigit(ch)) {
+            st.push(ch - '0');
+        } else {
+            int val2 = st.top(); st.pop();
+            int val1 = st.top(); st.pop();
+            switch (ch) {
+                case '+': st.push(val1 + val2); break;
+                case '-': st.push(val1 - val2); break;
+                case '*': st.push(val1 * val2); break;
+                case '/': st.push(val1 / val2); break;
+            }
+        }
+    }
+    return st.top();
+}
+
+// From stack/advanced_problems.cpp
+int evalRPN(string tokens[], int n) {
+    stack<int> st;
+    for (int i = 0; i < n; i++) {
+        if (tokens[i] == "+" || tokens[i] == "-" ||
+            tokens[i] == "*" || tokens[i] == "/") {
+            int b = st.top(); st.pop();
+            int a = st.top(); st.pop();
+            if (tokens[i] == "+") st.push(a + b);
+            else if (tokens[i] == "-") st.push(a - b);
+            else if (tokens[i] == "*") st.push(a * b);
+            else st.push(a / b);
+        } else {
+            st.push(stoi(tokens[i]));
+        }
+    }
+    return st.top();
+}
+
+int calculate(string str) {
+    stack<int> st;
+    int result = 0;
+    int number = 0;
+    int sign = 1;
+    for (char ch : str) {
+        if (isdigit(ch)) {
+            number = number * 10 + (ch - '0');
+        } else if (ch == '+') {
+            result += sign * number;
+            number = 0;
+            sign = 1;
+        } else if (ch == '-') {
+            result += sign * number;
+            number = 0;
+            sign = -1;
+        } else if (ch == '(') {
+            st.push(result);
+            st.push(sign);
+            result = 0;
+            sign = 1;
+        } else if (ch == ')') {
+            result += sign * number;
+            number = 0;
+            result *= st.top(); st.pop();
+            result += st.top(); st.pop();
+        }
+    }
+    result += sign * number;
+    return result;
+}
+
+// ========================================
+// BENCHMARK: EXPRESSIONS PER SECOND
+// ========================================
+// Usage: benchmarkExpressionEngine(iterations)
+// Example: benchmarkExpressionEngine(1000000) - evaluates each workload
+// iterations times with the old functions and with the engine
+void benchmarkExpressionEngine(int iterations) {
+    using Clock = chrono::steady_clock;
+    long long checksum = 0;
+    auto rate = [](Clock::time_point start, double count) {
+        return count / chrono::duration<double>(Clock::now() - start).count() / 1e6;
+    };
+
+    vector<string> calcExprs = {"(1+(4+5+2)-3)+(6+8)", "12-(3+4)-(5-(6+7))", "100+200-(30-4)"};
+    vector<string> digitExprs = {"2*3+5", "(1+2)*(3+4)-5", "9-8/2+3*(4-1)"};
+    string rpnTokens[] = {"2", "1", "+", "3", "*"};
+    string rpnText = "2 1 + 3 *";
+    size_t exprs = calcExprs.size();
+
+    ExpressionCache cache;
+
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) checksum += calculate(calcExprs[i % exprs]);
+    cout << "calculate(string)                : " << rate(start, iterations) << " M expr/s" << endl;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) checksum += evaluateInfix(cache, calcExprs[i % exprs]);
+    cout << "engine (cached infix)            : " << rate(start, iterations) << " M expr/s" << endl;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        checksum += evaluatePostfix(infixToPostfix(digitExprs[i % exprs]));
+    }
+    cout << "infixToPostfix + evaluatePostfix : " << rate(start, iterations) << " M expr/s" << endl;
+
+    RPNProgram scratch;
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        compileInfix(digitExprs[i % exprs], scratch);
+        checksum += runProgram(scratch);
+    }
+    cout << "engine (compile every time)      : " << rate(start, iterations) << " M expr/s" << endl;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) checksum += evalRPN(rpnTokens, 5);
+    cout << "evalRPN(tokens)                  : " << rate(start, iterations) << " M expr/s" << endl;
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) checksum += evaluateRPN(cache, rpnText);
+    cout << "engine (cached RPN)              : " << rate(start, iterations) << " M expr/s" << endl;
+
+    // Same program over a batch of bindings
+    RPNProgram poly;
+    compileInfix("a*x^2 + b*x - c/2", poly);
+    size_t rows = (size_t)iterations;
+    size_t numVars = poly.variables.size();
+    vector<long long> bindings(rows * numVars), results(rows);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t v = 0; v < numVars; v++) bindings[r * numVars + v] = (long long)(r + v) % 97;
+    }
+
+    start = Clock::now();
+    for (size_t r = 0; r < rows; r++) results[r] = runProgram(poly, &bindings[r * numVars]);
+    cout << "engine (row at a time)           : " << rate(start, rows) << " M expr/s" << endl;
+    checksum += results[rows / 2];
+
+    start = Clock::now();
+    runBatch(poly, bindings.data(), rows, results.data());
+    cout << "engine (runBatch)                : " << rate(start, rows) << " M expr/s" << endl;
+    checksum += results[rows / 2];
+
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    cout << "=== Expression Engine ===" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Evaluate infix through the cache
+    // ExpressionCache cache;
+    // cout << "Result: " << evaluateInfix(cache, "(1+(4+5+2)-3)+(6+8)") << endl;
+
+    // 2. Evaluate RPN text
+    // cout << "RPN result: " << evaluateRPN(cache, "2 1 + 3 *") << endl;
+    // cout << "RPN with a negative literal: " << evaluateRPN(cache, "1 -2 +") << endl;
+
+    // 3. Compile once, bind variables
+    // RPNProgram prog;
+    // if (compileInfix("a*x^2 + b*x + c", prog)) {
+    //     vector<long long> vars(prog.variables.size());
+    //     vars[prog.slotOf("a")] = 2;
+    //     vars[prog.slotOf("x")] = 3;
+    //     vars[prog.slotOf("b")] = 4;
+    //     vars[prog.slotOf("c")] = 5;
+    //     cout << "2*3^2 + 4*3 + 5 = " << runProgram(prog, vars.data()) << endl;
+    // } else {
+    //     cout << "Compile error: " << prog.error << endl;
+    // }
+
+    // 4. Batch evaluation over many bindings
+    // RPNProgram line;
+    // compileInfix("m*x + b", line);  // Slots: m=0, x=1, b=2
+    // long long bindings[] = {2, 1, 0,   2, 2, 0,   3, 3, 1};
+    // long long results[3];
+    // runBatch(line, bindings, 3, results);
+    // cout << results[0] << " " << results[1] << " " << results[2] << endl;
+
+    // Benchmark against the existing stack-based functions
+    // benchmarkExpressionEngine(1000000);
+
+    return 0;
+}
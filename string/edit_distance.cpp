@@ -0,0 +1,443 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+using namespace std;
+
+// ========================================
+// FAST EDIT DISTANCE
+// ========================================
+// Concept: editDistance (advanced_problems.cpp) fills a full (m+1)x(n+1)
+// vector<vector<int>> per call: m+1 allocations and one cell at a time.
+// The variants below give the same Levenshtein distance:
+// - Two-row DP: only the previous and current row, O(min(m, n)) memory
+// - Myers / Hyyro bit-vector: one column of the DP table is stored as
+//   bit vectors of +1/-1 vertical deltas, so a 64-row slice of a column
+//   takes a handful of word operations. Strings up to 64 chars fit one
+//   word; longer ones use blocks of 64 rows chained by horizontal deltas
+// - Bounded (max-k): answers "distance, or -1 if above k". Length
+//   difference alone often rules a pair out; otherwise a banded DP over
+//   the 2k+1 central diagonals runs, stopping as soon as a whole row
+//   exceeds k
+// - EditDistanceBatch keeps its tables and rows between calls, so
+//   millions of distances do not allocate, and oneToMany builds the
+//   pattern's match table once for many candidates
+// Strings are compared byte by byte.
+
+// ========================================
+// 1. TWO-ROW DP
+// ========================================
+// Usage: distance = editDistanceTwoRow(str1, str2)
+// Example: editDistanceTwoRow("horse", "ros") returns 3
+int editDistanceTwoRow(string_view a, string_view b, vector<int>& prev, vector<int>& cur) {
+    if (a.size() < b.size()) swap(a, b);  // rows indexed by the shorter string
+    size_t n = b.size();
+    prev.resize(n + 1);
+    cur.resize(n + 1);
+    for (size_t j = 0; j <= n; j++) prev[j] = (int)j;
+    for (size_t i = 1; i <= a.size(); i++) {
+        cur[0] = (int)i;
+        char ca = a[i - 1];
+        for (size_t j = 1; j <= n; j++) {
+            int replace = prev[j - 1] + (ca != b[j - 1]);
+            cur[j] = min(replace, min(prev[j], cur[j - 1]) + 1);
+        }
+        swap(prev, cur);
+    }
+    return prev[n];
+}
+
+int editDistanceTwoRow(string_view a, string_view b) {
+    vector<int> prev, cur;
+    return editDistanceTwoRow(a, b, prev, cur);
+}
+
+// ========================================
+// 2. BANDED DP WITH MAX-K
+// ========================================
+// Concept: If the distance is at most k, the optimal path never leaves
+// the diagonals |i - j| <= k, so only 2k+1 cells per row are computed;
+// cells outside the band count as k+1. If every cell of a row is above
+// k, no later row can come back under it. The distance never exceeds
+// the longer length, so larger k is clamped to it and the band never
+// needs k + 1 or 2k + 1 past that.
+// Usage: d = editDistanceBanded(str1, str2, k) - distance, or -1 if > k
+// Example: editDistanceBanded("kitten", "sitting", 3) returns 3,
+//          editDistanceBanded("kitten", "sitting", 2) returns -1
+int editDistanceBanded(string_view a, string_view b, int k, vector<int>& prev, vector<int>& cur) {
+    if (k < 0) return -1;
+    if (a.size() < b.size()) swap(a, b);
+    long long m = (long long)a.size(), n = (long long)b.size();
+    if (m - n > k) return -1;
+    k = (int)min<long long>(k, m);
+    const int OUT = k + 1;
+    prev.assign(n + 2, OUT);
+    cur.assign(n + 2, OUT);
+    for (long long j = 0; j <= min<long long>(n, k); j++) prev[j] = (int)j;
+    for (long long i = 1; i <= m; i++) {
+        long long lo = max<long long>(0, i - k), hi = min<long long>(n, i + k);
+        int rowMin = OUT;
+        if (lo == 0) {
+            cur[0] = (int)min<long long>(i, OUT);
+            rowMin = cur[0];
+            lo = 1;
+        } else {
+            cur[lo - 1] = OUT;
+        }
+        char ca = a[i - 1];
+        for (long long j = lo; j <= hi; j++) {
+            int best = min(prev[j - 1] + (ca != b[j - 1]), min(prev[j], cur[j - 1]) + 1);
+            best = min(best, OUT);
+            cur[j] = best;
+            rowMin = min(rowMin, best);
+        }
+        cur[hi + 1] = OUT;  // next row reads it as "up" on its last diagonal
+        if (rowMin > k) return -1;
+        swap(prev, cur);
+    }
+    return prev[n] <= k ? prev[n] : -1;
+}
+
+int editDistanceBanded(string_view a, string_view b, int k) {
+    vector<int> prev, cur;
+    return editDistanceBanded(a, b, k, prev, cur);
+}
+
+// ========================================
+// 3. MYERS BIT-VECTOR (SINGLE AND MULTI-WORD)
+// ========================================
+// Concept: For pattern p (rows) and text t (columns), Peq[c] has bit i
+// set where p[i] == c. Pv / Mv mark rows whose vertical delta
+// D[i][j] - D[i-1][j] is +1 / -1. One step advances a 64-row block by
+// one text column; hin is the horizontal delta entering the block's top
+// row (+1 for the first block, since D[0][j] = j), and the delta leaving
+// its bottom row feeds the next block.
+
+// ph / mh return the horizontal +1 / -1 deltas of the new column (before shifting)
+inline void myersStep(uint64_t& pv, uint64_t& mv, uint64_t eq, int hin, uint64_t& ph, uint64_t& mh) {
+    uint64_t xv = eq | mv;
+    eq |= (uint64_t)(hin < 0);
+    uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    ph = mv | ~(xh | pv);
+    mh = pv & xh;
+    uint64_t phShift = (ph << 1) | (uint64_t)(hin > 0);
+    uint64_t mhShift = (mh << 1) | (uint64_t)(hin < 0);
+    pv = mhShift | ~(xv | phShift);
+    mv = phShift & xv;
+}
+
+// Usage: EditDistanceBatch batch; batch.distance(a, b); batch.distanceWithin(a, b, k);
+//        batch.oneToMany(query, candidates, out, k);
+// Example: batch.distance("horse", "ros") returns 3
+class EditDistanceBatch {
+public:
+    // Levenshtein distance of a and b
+    int distance(string_view a, string_view b) {
+        return bitParallel(a, b, -1);
+    }
+
+    // Distance if it is at most k, otherwise -1
+    int distanceWithin(string_view a, string_view b, int k) {
+        if (k < 0) return -1;
+        long long longer = (long long)max(a.size(), b.size());
+        if (longer - (long long)min(a.size(), b.size()) > k) return -1;
+        k = (int)min<long long>(k, longer);
+        // The band is cheaper than the bit-vector columns once 2k+1 rows
+        // are fewer than the blocks the shorter string needs (about 4
+        // cells cost as much as one 64-row block step)
+        size_t rows = min(a.size(), b.size());
+        if (2 * (long long)k + 1 < (long long)((rows + 63) / 64 * 4)) return editDistanceBanded(a, b, k, prev, cur);
+        return bitParallel(a, b, k);
+    }
+
+    // out[i] = distance(query, candidates[i]), or -1 past k when k >= 0.
+    // The query's match table is built once for all candidates.
+    void oneToMany(string_view query, const vector<string>& candidates, vector<int>& out, int k = -1) {
+        out.resize(candidates.size());
+        size_t m = query.size();
+        if (m == 0) {
+            for (size_t i = 0; i < candidates.size(); i++) {
+                int d = (int)candidates[i].size();
+                out[i] = k < 0 || d <= k ? d : -1;
+            }
+            return;
+        }
+        buildPeq(query);
+        for (size_t i = 0; i < candidates.size(); i++) {
+            const string& t = candidates[i];
+            if (k >= 0 && (long long)max(m, t.size()) - (long long)min(m, t.size()) > k) {
+                out[i] = -1;
+                continue;
+            }
+            out[i] = runColumns(m, t, k);
+        }
+        clearPeq(query);
+    }
+
+    // out[i] = distance of pairs[i] (or -1 past k when k >= 0)
+    void distances(const vector<pair<string, string>>& pairs, vector<int>& out, int k = -1) {
+        out.resize(pairs.size());
+        for (size_t i = 0; i < pairs.size(); i++) {
+            out[i] = k < 0 ? distance(pairs[i].first, pairs[i].second)
+                           : distanceWithin(pairs[i].first, pairs[i].second, k);
+        }
+    }
+
+private:
+    vector<uint64_t> peq;      // peq[c * blocks + b], all zero between calls
+    size_t blocks = 0;
+    vector<uint64_t> pv, mv;
+    vector<int> prev, cur;     // rows for the banded DP
+
+    void buildPeq(string_view p) {
+        blocks = (p.size() + 63) / 64;
+        if (peq.size() < 256 * blocks) peq.assign(256 * blocks, 0);
+        for (size_t i = 0; i < p.size(); i++) {
+            peq[(unsigned char)p[i] * blocks + i / 64] |= 1ULL << (i % 64);
+        }
+        if (pv.size() < blocks) {
+            pv.resize(blocks);
+            mv.resize(blocks);
+        }
+    }
+
+    // Reset only the entries the pattern set, instead of 2 KB per block
+    void clearPeq(string_view p) {
+        for (size_t i = 0; i < p.size(); i++) peq[(unsigned char)p[i] * blocks + i / 64] = 0;
+    }
+
+    // D[m][n] for the pattern in peq (m rows) against text t; with k >= 0,
+    // returns -1 as soon as the distance must exceed k
+    int runColumns(size_t m, string_view t, int k) {
+        long long score = (long long)m;
+        long long remaining = (long long)t.size();
+        const int lastBit = (int)((m - 1) % 64);
+        if (blocks == 1) {
+            uint64_t p = ~0ULL, q = 0, ph, mh;
+            for (unsigned char c : t) {
+                myersStep(p, q, peq[c], 1, ph, mh);
+                score += (long long)((ph >> lastBit) & 1) - (long long)((mh >> lastBit) & 1);
+                remaining--;
+                // Each remaining column lowers the last row by at most 1
+                if (k >= 0 && score - remaining > k) return -1;
+            }
+        } else {
+            fill(pv.begin(), pv.begin() + blocks, ~0ULL);
+            fill(mv.begin(), mv.begin() + blocks, 0);
+            for (unsigned char c : t) {
+                const uint64_t* eq = &peq[(size_t)c * blocks];
+                int carry = 1;
+                uint64_t ph = 0, mh = 0;
+                for (size_t b = 0; b < blocks; b++) {
+                    myersStep(pv[b], mv[b], eq[b], carry, ph, mh);
+                    carry = (int)(ph >> 63) - (int)(mh >> 63);
+                }
+                score += (long long)((ph >> lastBit) & 1) - (long long)((mh >> lastBit) & 1);
+                remaining--;
+                if (k >= 0 && score - remaining > k) return -1;
+            }
+        }
+        return k < 0 || score <= k ? (int)score : -1;
+    }
+
+    int bitParallel(string_view a, string_view b, int k) {
+        if (a.size() > b.size()) swap(a, b);  // fewer rows = fewer blocks
+        if (a.empty()) return k < 0 || (long long)b.size() <= k ? (int)b.size() : -1;
+        buildPeq(a);
+        int d = runColumns(a.size(), b, k);
+        clearPeq(a);
+        return d;
+    }
+};
+
+// Single-call helpers (allocate their scratch; use EditDistanceBatch in loops)
+// Usage: distance = editDistanceMyers(str1, str2)
+// Example: editDistanceMyers("horse", "ros") returns 3
+int editDistanceMyers(string_view a, string_view b) {
+    EditDistanceBatch batch;
+    return batch.distance(a, b);
+}
+
+// Usage: d = editDistanceWithin(str1, str2, k) - distance, or -1 if > k
+int editDistanceWithin(string_view a, string_view b, int k) {
+    EditDistanceBatch batch;
+    return batch.distanceWithin(a, b, k);
+}
+
+// ========================================
+// BASELINE (copy of advanced_problems.cpp)
+// ========================================
+
+int editDistance(string str1, string str2) {
+    int m = str1.length();
+    int n = str2.length();
+    vector<vector<int>> dp(m + 1, vector<int>(n + 1));
+
+    for (int i = 0; i <= m; i++) {
+        for (int j = 0; j <= n; j++) {
+            if (i == 0) {
+                dp[i][j] = j;
+            } else if (j == 0) {
+                dp[i][j] = i;
+            } else if (str1[i - 1] == str2[j - 1]) {
+                dp[i][j] = dp[i - 1][j - 1];
+            } else {
+                dp[i][j] = 1 + min({dp[i - 1][j],
+                                     dp[i][j - 1],
+                                     dp[i - 1][j - 1]});
+            }
+        }
+    }
+
+    return dp[m][n];
+}
+
+// ========================================
+// BENCHMARK: PAIRS PER SECOND
+// ========================================
+// Usage: benchmarkEditDistance(shortPairs, longPairs)
+// Example: benchmarkEditDistance(200000, 4) - 8..64-char and 10K-char pairs
+void benchmarkEditDistance(size_t shortPairs, size_t longPairs) {
+    using Clock = chrono::steady_clock;
+    mt19937 rng(20);
+    auto randomString = [&](size_t len) {
+        string s(len, 'a');
+        for (char& c : s) c = (char)('a' + rng() % 20);
+        return s;
+    };
+    // Second string = first with about `edits` random substitutions / insertions / deletions
+    auto mutate = [&](string s, size_t edits) {
+        for (size_t e = 0; e < edits; e++) {
+            size_t pos = s.empty() ? 0 : rng() % s.size();
+            switch (rng() % 3) {
+                case 0: if (!s.empty()) s[pos] = (char)('a' + rng() % 20); break;
+                case 1: s.insert(s.begin() + pos, (char)('a' + rng() % 20)); break;
+                default: if (!s.empty()) s.erase(s.begin() + pos); break;
+            }
+        }
+        return s;
+    };
+
+    auto makePairs = [&](size_t count, size_t minLen, size_t maxLen, size_t edits) {
+        vector<pair<string, string>> pairs;
+        for (size_t i = 0; i < count; i++) {
+            string a = randomString(minLen + rng() % (maxLen - minLen + 1));
+            pairs.push_back({a, mutate(a, edits)});
+        }
+        return pairs;
+    };
+
+    auto rate = [&](size_t count, auto&& body) {
+        auto start = Clock::now();
+        long long checksum = body();
+        double secs = chrono::duration<double>(Clock::now() - start).count();
+        cout << count / secs << " (" << checksum << ")  ";
+    };
+
+    EditDistanceBatch batch;
+    vector<int> out;
+    cout << "pairs/sec (checksum)" << endl;
+    cout << "case  original  twoRow  myers  within(k)" << endl;
+
+    struct Case { const char* name; size_t count, minLen, maxLen, edits; int k; bool runOriginal; };
+    Case cases[] = {
+        {"short 8-64, 3 edits, k=4", shortPairs, 8, 64, 3, 4, true},
+        {"short 8-64, random, k=4", shortPairs, 8, 64, 1000, 4, true},
+        {"long 10K, 50 edits, k=100", longPairs, 10000, 10000, 50, 100, false},
+    };
+    for (const Case& c : cases) {
+        vector<pair<string, string>> pairs = makePairs(c.count, c.minLen, c.maxLen, c.edits);
+        if (c.edits == 1000) {
+            // Unrelated strings: the bounded mode mostly rejects them
+            for (auto& p : pairs) p.second = randomString(c.minLen + rng() % (c.maxLen - c.minLen + 1));
+        }
+        cout << c.name << "  ";
+        if (c.runOriginal) {
+            rate(c.count, [&] {
+                long long sum = 0;
+                for (auto& p : pairs) sum += editDistance(p.first, p.second);
+                return sum;
+            });
+        } else {
+            cout << "-  ";  // a 10K x 10K table of ints is 400 MB per call
+        }
+        vector<int> prev, cur;
+        rate(c.count, [&] {
+            long long sum = 0;
+            for (auto& p : pairs) sum += editDistanceTwoRow(p.first, p.second, prev, cur);
+            return sum;
+        });
+        rate(c.count, [&] {
+            batch.distances(pairs, out);
+            long long sum = 0;
+            for (int d : out) sum += d;
+            return sum;
+        });
+        rate(c.count, [&] {
+            batch.distances(pairs, out, c.k);
+            long long sum = 0;
+            for (int d : out) sum += d;
+            return sum;
+        });
+        cout << endl;
+    }
+
+    // One query against many candidates (match table built once)
+    vector<string> candidates;
+    string query = randomString(32);
+    for (size_t i = 0; i < shortPairs; i++) candidates.push_back(mutate(query, rng() % 8));
+    auto start = Clock::now();
+    batch.oneToMany(query, candidates, out, 3);
+    double secs = chrono::duration<double>(Clock::now() - start).count();
+    cout << "oneToMany 32 chars, k=3: " << candidates.size() / secs << " pairs/sec, "
+         << count_if(out.begin(), out.end(), [](int d) { return d >= 0; }) << " within k" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Fast Edit Distance ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Two-row DP
+    // cout << "Edit distance: " << editDistanceTwoRow(str, "ros") << endl;
+
+    // 2. Banded with a threshold
+    // int d = editDistanceBanded(str, "ros", 2);
+    // if (d >= 0) {
+    //     cout << "Edit distance: " << d << endl;
+    // } else {
+    //     cout << "Edit distance is above 2." << endl;
+    // }
+
+    // 3. Bit-vector (any length)
+    // cout << "Edit distance: " << editDistanceMyers(str, "ros") << endl;
+
+    // Many distances with one reusable scratch
+    // EditDistanceBatch batch;
+    // vector<string> candidates = {"rose", "horse", "ros", "house"};
+    // vector<int> out;
+    // batch.oneToMany(str, candidates, out, 2);
+    // for (size_t i = 0; i < out.size(); i++) cout << candidates[i] << ": " << out[i] << endl;
+
+    // Pairs per second
+    // benchmarkEditDistance(200000, 4);
+
+    return 0;
+}
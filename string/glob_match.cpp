@@ -0,0 +1,456 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+// ========================================
+// COMPILED WILDCARD MATCHING
+// ========================================
+// Concept: wildcardMatch (advanced_problems.cpp) fills an O(m*n)
+// vector<vector<bool>> for every (string, pattern) call. When the same
+// few hundred patterns are tested against millions of strings, the
+// pattern work can be done once:
+// - CompiledGlob splits a pattern at its '*' runs into segments. The
+//   first segment must match at the start, the last at the end, and the
+//   middle ones are found left to right, each at its leftmost
+//   occurrence; taking the leftmost is always safe because a '*' can
+//   absorb anything between segments. No table, no backtracking over
+//   the string beyond the segment search
+// - GlobCache keeps compiled patterns by text (least recently used
+//   patterns are evicted), so callers can keep passing pattern strings
+// - GlobSet tests one string against every pattern in a single pass by
+//   running all patterns' NFAs at once as one bit vector (Shift-And
+//   with self-loops for '*'). A subset-construction DFA would be faster
+//   per byte, but a few hundred patterns with several '*' each reach
+//   thousands of states on ordinary paths, so its memory is unbounded
+// Same syntax as wildcardMatch: '*' matches any sequence (including
+// empty), '?' any single character, everything else itself.
+
+// ========================================
+// 1. COMPILED PATTERN
+// ========================================
+// Usage: CompiledGlob g("*.log"); g.match("error.log")
+// Example: CompiledGlob("*a*b").match("adceb") returns true
+class CompiledGlob {
+public:
+    explicit CompiledGlob(string_view pattern) {
+        Segment current;
+        for (char c : pattern) {
+            if (c == '*') {
+                hasStar = true;
+                parts.push_back(current);
+                current = Segment();
+                // Runs of '*' give empty middle segments; drop them below
+            } else {
+                current.text += c;
+                current.hasAny |= c == '?';
+            }
+        }
+        parts.push_back(current);
+        if (parts.size() > 2) {
+            // Keep first and last, drop empty middle segments
+            vector<Segment> kept = {parts.front()};
+            for (size_t i = 1; i + 1 < parts.size(); i++) {
+                if (!parts[i].text.empty()) kept.push_back(parts[i]);
+            }
+            kept.push_back(parts.back());
+            parts.swap(kept);
+        }
+        for (const Segment& s : parts) minLength += s.text.size();
+    }
+
+    bool match(string_view s) const {
+        if (!hasStar) return s.size() == minLength && segmentAt(parts[0], s.data());
+        if (s.size() < minLength) return false;
+        const Segment& first = parts.front();
+        const Segment& last = parts.back();
+        if (!segmentAt(first, s.data())) return false;
+        if (!segmentAt(last, s.data() + s.size() - last.text.size())) return false;
+        size_t pos = first.text.size(), end = s.size() - last.text.size();
+        for (size_t i = 1; i + 1 < parts.size(); i++) {
+            size_t at = findSegment(parts[i], s, pos, end);
+            if (at == string::npos) return false;
+            pos = at + parts[i].text.size();
+        }
+        return true;
+    }
+
+private:
+    struct Segment {
+        string text;
+        bool hasAny = false;  // contains '?'
+    };
+    vector<Segment> parts;   // pattern split at '*' runs
+    bool hasStar = false;
+    size_t minLength = 0;    // non-'*' characters
+
+    static bool segmentAt(const Segment& seg, const char* p) {
+        size_t len = seg.text.size();
+        if (!seg.hasAny) return memcmp(p, seg.text.data(), len) == 0;
+        for (size_t i = 0; i < len; i++) {
+            if (seg.text[i] != '?' && seg.text[i] != p[i]) return false;
+        }
+        return true;
+    }
+
+    // Leftmost start of seg inside s[from, end), or npos
+    static size_t findSegment(const Segment& seg, string_view s, size_t from, size_t end) {
+        size_t len = seg.text.size();
+        if (end - from < len) return string::npos;
+        if (!seg.hasAny) {
+            size_t at = s.substr(from, end - from).find(seg.text);
+            return at == string::npos ? at : from + at;
+        }
+        for (size_t i = from; i + len <= end; i++) {
+            if (segmentAt(seg, s.data() + i)) return i;
+        }
+        return string::npos;
+    }
+};
+
+// ========================================
+// 2. COMPILED-PATTERN CACHE
+// ========================================
+// Usage: GlobCache cache(512); cache.match(str, pattern)
+// Example: cache.match("adceb", "*a*b") returns true (compiles "*a*b" once)
+class GlobCache {
+public:
+    explicit GlobCache(size_t capacity = 1024) : capacity(max<size_t>(1, capacity)) {}
+
+    const CompiledGlob& get(const string& pattern) {
+        auto it = index.find(pattern);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);  // mark most recent
+            return it->second->second;
+        }
+        if (entries.size() == capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+        entries.emplace_front(pattern, CompiledGlob(pattern));
+        index[pattern] = entries.begin();
+        return entries.front().second;
+    }
+
+    bool match(string_view str, const string& pattern) { return get(pattern).match(str); }
+
+    size_t size() const { return entries.size(); }
+
+private:
+    size_t capacity;
+    list<pair<string, CompiledGlob>> entries;  // most recently used first
+    unordered_map<string, list<pair<string, CompiledGlob>>::iterator> index;
+};
+
+// Drop-in for wildcardMatch that compiles each distinct pattern once
+// Usage: result = wildcardMatchCached(str, pattern)
+bool wildcardMatchCached(string_view str, const string& pattern) {
+    static GlobCache cache;
+    return cache.match(str, pattern);
+}
+
+// ========================================
+// 3. PATTERN SET (BIT-PARALLEL NFA)
+// ========================================
+// Concept: An NFA position is (pattern p, index j): "the next pattern
+// character to match is p[j]". All patterns' positions are laid out in
+// one bit vector, each pattern followed by an END bit. Per input byte:
+//   next = ((active & matches[byte]) << 1) | (active & stars)
+//   next |= (next & stars) << 1      // '*' may match empty
+// where matches[byte] holds literal-byte and '?' positions. A bit never
+// shifts out of its pattern because END bits are in neither mask. The
+// whole set costs one pass of ~positions/64 word operations per byte;
+// words with no active bit are skipped, and the scan stops once nothing
+// is active (or, for matchAny, once a pattern is sitting on a final '*').
+// Usage: GlobSet set({"*.log", "/var/*", "?ar*"});
+//        set.matchAny(path); set.matchAll(path, ids);
+// Example: GlobSet({"*.txt", "a*"}).matchAll("a.txt", ids) gives ids {0, 1}
+class GlobSet {
+public:
+    explicit GlobSet(const vector<string>& patterns) : count(patterns.size()) {
+        // Lay out positions; star runs collapse to one '*'
+        vector<int16_t> kind;
+        for (size_t p = 0; p < patterns.size(); p++) {
+            starts.push_back(kind.size());
+            char prev = 0;
+            for (char c : patterns[p]) {
+                if (c == '*' && prev == '*') continue;
+                kind.push_back(c == '*' ? STAR : c == '?' ? ANY : (int16_t)(unsigned char)c);
+                prev = c;
+            }
+            ends.push_back(kind.size());
+            kind.push_back(END);
+        }
+        words = (kind.size() + 63) / 64;
+
+        // Bytes that appear in no pattern share class 0 (only '?' matches them)
+        for (int16_t k : kind) {
+            if (k >= 0 && byteClass[k] == 0) byteClass[k] = (uint16_t)numClasses++;
+        }
+        matches.assign((size_t)numClasses * words, 0);
+        stars.assign(words, 0);
+        endBits.assign(words, 0);
+        finalStars.assign(words, 0);
+        start.assign(words, 0);
+        for (size_t i = 0; i < kind.size(); i++) {
+            uint64_t bit = 1ULL << (i % 64);
+            size_t w = i / 64;
+            if (kind[i] == STAR) {
+                stars[w] |= bit;
+                if (kind[i + 1] == END) finalStars[w] |= bit;
+            } else if (kind[i] == ANY) {
+                for (uint32_t c = 0; c < numClasses; c++) matches[(size_t)c * words + w] |= bit;
+            } else if (kind[i] == END) {
+                endBits[w] |= bit;
+            } else {
+                matches[(size_t)byteClass[kind[i]] * words + w] |= bit;
+            }
+        }
+        for (size_t s : starts) start[s / 64] |= 1ULL << (s % 64);
+        closeStars(start.data());
+        active.resize(words);
+    }
+
+    size_t patternCount() const { return count; }
+
+    // True if any pattern matches s
+    bool matchAny(string_view s) {
+        if (!run(s, true)) return false;
+        for (size_t w = 0; w < words; w++) {
+            if (active[w] & (endBits[w] | finalStars[w])) return true;
+        }
+        return false;
+    }
+
+    // ids of all patterns matching s, in increasing order
+    void matchAll(string_view s, vector<int>& ids) {
+        ids.clear();
+        if (!run(s, false)) return;
+        for (size_t p = 0; p < count; p++) {
+            if (active[ends[p] / 64] >> (ends[p] % 64) & 1) ids.push_back((int)p);
+        }
+    }
+
+private:
+    static constexpr int16_t STAR = -1, ANY = -2, END = -3;
+
+    size_t count;
+    size_t words = 0;
+    vector<size_t> starts, ends;  // first position / END position per pattern
+    uint16_t byteClass[256] = {0};
+    uint32_t numClasses = 1;
+    vector<uint64_t> matches;     // numClasses x words
+    vector<uint64_t> stars, endBits, finalStars, start;
+    vector<uint64_t> active;
+
+    // next |= (next & stars) << 1 across words
+    void closeStars(uint64_t* v) const {
+        uint64_t carry = 0;
+        for (size_t w = 0; w < words; w++) {
+            uint64_t s = v[w] & stars[w];
+            v[w] |= (s << 1) | carry;
+            carry = s >> 63;
+        }
+    }
+
+    // Leaves the final state in active; false once it is empty.
+    // With stopOnFinalStar, also returns early (true) when some pattern
+    // has reached a trailing '*', since the rest of s cannot matter.
+    bool run(string_view s, bool stopOnFinalStar) {
+        uint64_t* a = active.data();
+        copy(start.begin(), start.end(), a);
+        for (unsigned char c : s) {
+            if (stopOnFinalStar) {
+                for (size_t w = 0; w < words; w++) {
+                    if (a[w] & finalStars[w]) return true;
+                }
+            }
+            const uint64_t* m = matches.data() + (size_t)byteClass[c] * words;
+            uint64_t carry = 0, any = 0;
+            for (size_t w = 0; w < words; w++) {
+                uint64_t cur = a[w];
+                if ((cur | carry) == 0) continue;  // nothing alive in this word
+                uint64_t adv = cur & m[w];
+                uint64_t next = (adv << 1) | carry | (cur & stars[w]);
+                carry = adv >> 63;
+                a[w] = next;
+                any |= next;
+            }
+            if (!any) return false;
+            closeStars(a);
+        }
+        return true;
+    }
+};
+
+// ========================================
+// BASELINE (copy of advanced_problems.cpp)
+// ========================================
+
+bool wildcardMatch(string str, string pattern) {
+    int m = str.length();
+    int n = pattern.length();
+    vector<vector<bool>> dp(m + 1, vector<bool>(n + 1, false));
+
+    dp[0][0] = true;
+
+    for (int j = 1; j <= n; j++) {
+        if (pattern[j - 1] == '*') {
+            dp[0][j] = dp[0][j - 1];
+        }
+    }
+
+    for (int i = 1; i <= m; i++) {
+        for (int j = 1; j <= n; j++) {
+            if (pattern[j - 1] == '*') {
+                dp[i][j] = dp[i - 1][j] || dp[i][j - 1];
+            } else if (pattern[j - 1] == '?' || str[i - 1] == pattern[j - 1]) {
+                dp[i][j] = dp[i - 1][j - 1];
+            }
+        }
+    }
+
+    return dp[m][n];
+}
+
+// ========================================
+// BENCHMARK: MATCHES PER SECOND
+// ========================================
+// Usage: benchmarkGlobMatch(paths, patterns)
+// Example: benchmarkGlobMatch(100000, 200) - 100K paths x 200 patterns
+void benchmarkGlobMatch(size_t pathCount, size_t patternCount) {
+    using Clock = chrono::steady_clock;
+    auto seconds = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    mt19937 rng(23);
+    const char* dirs[] = {"usr", "lib", "var", "log", "home", "src", "test", "build", "include", "python3"};
+    const char* exts[] = {".py", ".log", ".cpp", ".h", ".txt", ".json", ".so", ""};
+    vector<string> paths;
+    for (size_t i = 0; i < pathCount; i++) {
+        string p;
+        int depth = 2 + rng() % 5;
+        for (int d = 0; d < depth; d++) {
+            p += '/';
+            p += dirs[rng() % 10];
+        }
+        p += "/file_" + to_string(rng() % 1000) + exts[rng() % 8];
+        paths.push_back(p);
+    }
+    // Patterns built from the same pieces: suffix, prefix, infix and '?' forms
+    vector<string> patterns;
+    for (size_t i = 0; i < patternCount; i++) {
+        string d = dirs[rng() % 10], e = exts[rng() % 7];
+        switch (rng() % 5) {
+            case 0: patterns.push_back("*" + e); break;
+            case 1: patterns.push_back("/" + d + "/*"); break;
+            case 2: patterns.push_back("*/" + d + "/*" + e); break;
+            case 3: patterns.push_back("*file_" + to_string(rng() % 10) + "?" + e); break;
+            default: patterns.push_back("/*/" + d + "*/file_??" + to_string(rng() % 10) + "*"); break;
+        }
+    }
+
+    // Pair-wise: DP on a slice (it is slow), compiled and cached on all
+    size_t dpPaths = min<size_t>(pathCount, 2000);
+    auto start = Clock::now();
+    size_t dpHits = 0;
+    for (size_t i = 0; i < dpPaths; i++) {
+        for (const string& pat : patterns) dpHits += wildcardMatch(paths[i], pat);
+    }
+    double dpRate = dpPaths * patterns.size() / seconds(start);
+
+    start = Clock::now();
+    vector<CompiledGlob> compiled;
+    for (const string& pat : patterns) compiled.emplace_back(pat);
+    size_t hits = 0, sliceHits = 0;
+    for (size_t i = 0; i < pathCount; i++) {
+        for (const CompiledGlob& g : compiled) {
+            bool m = g.match(paths[i]);
+            hits += m;
+            if (i < dpPaths) sliceHits += m;
+        }
+    }
+    double compiledRate = pathCount * patterns.size() / seconds(start);
+
+    GlobCache cache(patterns.size());
+    start = Clock::now();
+    size_t cachedHits = 0;
+    for (size_t i = 0; i < pathCount; i++) {
+        for (const string& pat : patterns) cachedHits += cache.match(paths[i], pat);
+    }
+    double cachedRate = pathCount * patterns.size() / seconds(start);
+
+    // One pass per path over all patterns
+    start = Clock::now();
+    GlobSet set(patterns);
+    vector<int> ids;
+    size_t setHits = 0, anyHits = 0;
+    for (const string& p : paths) {
+        set.matchAll(p, ids);
+        setHits += ids.size();
+    }
+    double setRate = pathCount * patterns.size() / seconds(start);
+    start = Clock::now();
+    for (const string& p : paths) anyHits += set.matchAny(p);
+    double anyRate = pathCount / seconds(start);
+
+    cout << pathCount << " paths x " << patterns.size() << " patterns (" << hits << " matches)" << endl;
+    cout << "DP wildcardMatch:   " << dpRate << " matches/sec"
+         << (dpHits == sliceHits ? "" : "  MISMATCH") << endl;
+    cout << "CompiledGlob:       " << compiledRate << " matches/sec" << endl;
+    cout << "GlobCache:          " << cachedRate << " matches/sec" << (cachedHits == hits ? "" : "  MISMATCH") << endl;
+    cout << "GlobSet matchAll:   " << setRate << " pattern tests/sec"
+         << (setHits == hits ? "" : "  MISMATCH") << endl;
+    cout << "GlobSet matchAny:   " << anyRate << " paths/sec (" << anyHits << " paths match something)" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Compiled Wildcard Matching ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Compile once, match many times
+    // CompiledGlob glob("*a*b");
+    // if (glob.match(str)) {
+    //     cout << "Pattern matches." << endl;
+    // } else {
+    //     cout << "Pattern does not match." << endl;
+    // }
+
+    // 2. Pattern text in, cached compile
+    // cout << "Cached: " << (wildcardMatchCached(str, "*a*b") ? "match" : "no match") << endl;
+
+    // 3. One pass against a whole set of patterns
+    // GlobSet set({"*.log", "/var/*", "?ar*", "*a*b"});
+    // vector<int> ids;
+    // set.matchAll(str, ids);
+    // cout << "Matching patterns:";
+    // for (int id : ids) cout << " " << id;
+    // cout << endl;
+
+    // Matches per second vs the DP version
+    // benchmarkGlobMatch(100000, 200);
+
+    return 0;
+}
@@ -0,0 +1,460 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+// ========================================
+// MULTI-PATTERN SEARCH (AHO-CORASICK)
+// ========================================
+// Concept: rabinKarp (advanced_problems.cpp) and findSubstring /
+// countSubstring (core_problems.cpp) look for one pattern per pass, so
+// k patterns cost k scans of the text. An Aho-Corasick automaton finds
+// every occurrence of every pattern in a single pass, one table lookup
+// per input byte, independent of k.
+// - Bytes that appear in no pattern share one class, so table rows are
+//   only (distinct pattern bytes + 1) wide
+// - States are numbered breadth-first. The shallow states, where the
+//   scan spends almost all its time, get full dense rows (every
+//   transition precomputed); deeper states keep only their sorted trie
+//   edges and fall back along failure links to a dense state
+// - Matches are reported through a callback as (start offset, pattern id);
+//   nothing is printed or collected unless the caller does it
+// - A Stream keeps the automaton state between calls, so text arriving in
+//   chunks finds matches that straddle chunk boundaries
+// Empty patterns are ignored. Duplicate patterns each report their own id.
+
+// ========================================
+// 1. AUTOMATON
+// ========================================
+// Usage: AhoCorasick ac({"he", "she", "his", "hers"});
+//        ac.search(text, [](size_t start, int id) { ... });
+// Example: searching "ushers" reports (1,"she"), (2,"he"), (2,"hers")
+class AhoCorasick {
+public:
+    // Dense rows for the first states in BFS order, up to this many bytes
+    static constexpr size_t DEFAULT_DENSE_BUDGET = 1 << 20;
+
+    explicit AhoCorasick(const vector<string>& patterns, size_t denseBudgetBytes = DEFAULT_DENSE_BUDGET) {
+        build(patterns, denseBudgetBytes);
+    }
+
+    size_t patternCount() const { return patternLength.size(); }
+    size_t stateCount() const { return fail.size(); }
+    size_t denseStateCount() const { return denseCount; }
+    size_t classCount() const { return numClasses; }
+
+    size_t memoryBytes() const {
+        return dense.size() * sizeof(uint32_t) + fail.size() * sizeof(uint32_t) +
+               edgeBegin.size() * sizeof(uint32_t) + edgeClass.size() * sizeof(uint16_t) +
+               edgeTarget.size() * sizeof(uint32_t) + outBegin.size() * sizeof(uint32_t) +
+               outPattern.size() * sizeof(uint32_t) + dictLink.size() * sizeof(uint32_t) +
+               patternLength.size() * sizeof(uint32_t) + sizeof(byteClass);
+    }
+
+    // Chunked scanning: matches are reported with offsets from the start
+    // of the whole stream, including ones that span chunk boundaries.
+    // Usage: auto stream = ac.stream(); stream.feed(chunk1, cb); stream.feed(chunk2, cb);
+    class Stream {
+    public:
+        explicit Stream(const AhoCorasick& automaton) : ac(&automaton) {}
+
+        template <typename Callback>
+        void feed(const char* data, size_t n, Callback&& onMatch) {
+            const unsigned char* p = (const unsigned char*)data;
+            uint32_t s = state;
+            for (size_t i = 0; i < n; i++) {
+                s = ac->step(s & ID_MASK, ac->byteClass[p[i]]);
+                if (s & OUTPUT_BIT) ac->report(s & ID_MASK, offset + i, onMatch);
+            }
+            state = s;
+            offset += n;
+        }
+        template <typename Callback>
+        void feed(string_view chunk, Callback&& onMatch) { feed(chunk.data(), chunk.size(), onMatch); }
+
+        void reset() { state = 0; offset = 0; }
+        uint64_t position() const { return offset; }
+
+    private:
+        const AhoCorasick* ac;
+        uint32_t state = 0;
+        uint64_t offset = 0;
+    };
+
+    Stream stream() const { return Stream(*this); }
+
+    template <typename Callback>
+    void search(string_view text, Callback&& onMatch) const {
+        Stream s(*this);
+        s.feed(text, onMatch);
+    }
+
+    // Total matches of all patterns (overlapping)
+    size_t countMatches(string_view text) const {
+        size_t count = 0;
+        search(text, [&](size_t, int) { count++; });
+        return count;
+    }
+
+private:
+    static constexpr uint32_t NONE = 0;  // root never has output, so 0 means "no link"
+    // Transition targets carry this bit when the target state reports a
+    // match, so the scan needs no extra per-state lookup
+    static constexpr uint32_t OUTPUT_BIT = 1u << 31;
+    static constexpr uint32_t ID_MASK = OUTPUT_BIT - 1;
+
+    uint16_t byteClass[256];
+    uint32_t numClasses = 1;
+    uint32_t denseCount = 0;
+    vector<uint32_t> dense;          // denseCount * numClasses, fully resolved (tagged)
+    vector<uint32_t> fail;           // failure link per state (untagged)
+    vector<uint32_t> edgeBegin;      // trie edges of state s: [edgeBegin[s], edgeBegin[s+1])
+    vector<uint16_t> edgeClass;      //   sorted by class
+    vector<uint32_t> edgeTarget;     //   (tagged)
+    vector<uint32_t> outBegin;       // patterns ending exactly at s: [outBegin[s], outBegin[s+1])
+    vector<uint32_t> outPattern;
+    vector<uint32_t> dictLink;       // nearest state on the failure chain with its own output
+    vector<uint32_t> patternLength;
+
+    uint32_t step(uint32_t s, uint32_t cls) const {
+        if (s < denseCount) return dense[(size_t)s * numClasses + cls];
+        if (cls == 0) return 0;  // byte occurs in no pattern
+        while (s >= denseCount) {
+            uint32_t lo = edgeBegin[s], hi = edgeBegin[s + 1];
+            if (hi - lo <= 8) {
+                for (uint32_t e = lo; e < hi; e++) {
+                    if (edgeClass[e] == cls) return edgeTarget[e];
+                }
+            } else {
+                auto it = lower_bound(edgeClass.begin() + lo, edgeClass.begin() + hi, (uint16_t)cls);
+                if (it != edgeClass.begin() + hi && *it == cls) return edgeTarget[it - edgeClass.begin()];
+            }
+            s = fail[s];
+        }
+        return dense[(size_t)s * numClasses + cls];
+    }
+
+    template <typename Callback>
+    void report(uint32_t s, uint64_t endOffset, Callback& onMatch) const {
+        if (outBegin[s] == outBegin[s + 1]) s = dictLink[s];
+        while (s != NONE) {
+            for (uint32_t k = outBegin[s]; k < outBegin[s + 1]; k++) {
+                uint32_t id = outPattern[k];
+                onMatch((size_t)(endOffset + 1 - patternLength[id]), (int)id);
+            }
+            s = dictLink[s];
+        }
+    }
+
+    void build(const vector<string>& patterns, size_t denseBudgetBytes) {
+        // Byte classes: 0 for bytes in no pattern, 1.. for the rest
+        bool used[256] = {false};
+        for (const string& p : patterns) {
+            for (unsigned char c : p) used[c] = true;
+        }
+        for (int b = 0; b < 256; b++) byteClass[b] = used[b] ? (uint16_t)numClasses++ : 0;
+
+        // Trie with unsorted child lists (node 0 = root)
+        vector<vector<pair<uint16_t, uint32_t>>> children(1);
+        vector<vector<uint32_t>> ends(1);
+        patternLength.resize(patterns.size());
+        for (size_t id = 0; id < patterns.size(); id++) {
+            patternLength[id] = (uint32_t)patterns[id].size();
+            if (patterns[id].empty()) continue;
+            uint32_t node = 0;
+            for (unsigned char c : patterns[id]) {
+                uint16_t cls = byteClass[c];
+                uint32_t next = 0;
+                for (auto& edge : children[node]) {
+                    if (edge.first == cls) {
+                        next = edge.second;
+                        break;
+                    }
+                }
+                if (next == 0) {
+                    next = (uint32_t)children.size();
+                    children[node].push_back({cls, next});
+                    children.emplace_back();
+                    ends.emplace_back();
+                }
+                node = next;
+            }
+            ends[node].push_back((uint32_t)id);
+        }
+
+        // Renumber breadth-first so dense states are 0..denseCount-1
+        size_t states = children.size();
+        vector<uint32_t> order;
+        order.reserve(states);
+        order.push_back(0);
+        for (size_t i = 0; i < order.size(); i++) {
+            auto& kids = children[order[i]];
+            sort(kids.begin(), kids.end());
+            for (auto& edge : kids) order.push_back(edge.second);
+        }
+        vector<uint32_t> newId(states);
+        for (size_t i = 0; i < states; i++) newId[order[i]] = (uint32_t)i;
+
+        edgeBegin.assign(states + 1, 0);
+        outBegin.assign(states + 1, 0);
+        for (size_t i = 0; i < states; i++) {
+            uint32_t old = order[i];
+            edgeBegin[i + 1] = edgeBegin[i] + (uint32_t)children[old].size();
+            for (auto& edge : children[old]) {
+                edgeClass.push_back(edge.first);
+                edgeTarget.push_back(newId[edge.second]);
+            }
+            outBegin[i + 1] = outBegin[i] + (uint32_t)ends[old].size();
+            outPattern.insert(outPattern.end(), ends[old].begin(), ends[old].end());
+        }
+        children.clear();
+        children.shrink_to_fit();
+        ends.clear();
+        ends.shrink_to_fit();
+
+        size_t rowBytes = (size_t)numClasses * sizeof(uint32_t);
+        denseCount = (uint32_t)max<size_t>(1, min(states, denseBudgetBytes / rowBytes));
+        dense.assign((size_t)denseCount * numClasses, 0);
+        fail.assign(states, 0);
+        dictLink.assign(states, NONE);
+
+        // BFS order = id order, and fail[s] is shallower than s, so its
+        // row and links are complete before s is processed. step() only
+        // visits states shallower than the one being built.
+        for (uint32_t s = 0; s < states; s++) {
+            for (uint32_t e = edgeBegin[s]; e < edgeBegin[s + 1]; e++) {
+                uint32_t child = edgeTarget[e];
+                uint32_t f = s == 0 ? 0 : step(fail[s], edgeClass[e]) & ID_MASK;
+                fail[child] = f;
+                dictLink[child] = outBegin[f] != outBegin[f + 1] ? f : dictLink[f];
+                if (outBegin[child] != outBegin[child + 1] || dictLink[child] != NONE) edgeTarget[e] |= OUTPUT_BIT;
+            }
+            if (s < denseCount) {
+                // Start from the failure state's row, then add own edges
+                uint32_t* row = &dense[(size_t)s * numClasses];
+                if (s != 0) {
+                    const uint32_t* fallback = &dense[(size_t)fail[s] * numClasses];
+                    copy(fallback, fallback + numClasses, row);
+                }
+                for (uint32_t e = edgeBegin[s]; e < edgeBegin[s + 1]; e++) row[edgeClass[e]] = edgeTarget[e];
+            }
+        }
+    }
+};
+
+// ========================================
+// 2. SINGLE-PATTERN RABIN-KARP (64-BIT)
+// ========================================
+// Concept: Same rolling hash as rabinKarp, but modulo the Mersenne prime
+// 2^61 - 1 with 128-bit products instead of q = 101 in 32-bit int, so a
+// window whose hash matches is almost always a real match and long
+// patterns cannot overflow. Matches go to a callback instead of cout.
+// Usage: rabinKarpSearch(text, pattern, [](size_t start) { ... })
+// Example: rabinKarpSearch("AABAACAADAABAABA", "AABA", cb) calls cb(0), cb(9), cb(12)
+const uint64_t RK_MOD = (1ULL << 61) - 1;
+
+inline uint64_t mulMod61(uint64_t a, uint64_t b) {
+    unsigned __int128 product = (unsigned __int128)a * b;
+    uint64_t r = (uint64_t)(product & RK_MOD) + (uint64_t)(product >> 61);
+    return r >= RK_MOD ? r - RK_MOD : r;
+}
+
+inline uint64_t addMod61(uint64_t a, uint64_t b) {
+    uint64_t r = a + b;
+    return r >= RK_MOD ? r - RK_MOD : r;
+}
+
+template <typename Callback>
+void rabinKarpSearch(string_view text, string_view pattern, Callback&& onMatch) {
+    size_t n = text.size(), m = pattern.size();
+    if (m == 0 || m > n) return;
+    const uint64_t base = 257;
+    uint64_t high = 1, p = 0, t = 0;
+    for (size_t i = 0; i + 1 < m; i++) high = mulMod61(high, base);
+    for (size_t i = 0; i < m; i++) {
+        p = addMod61(mulMod61(p, base), (unsigned char)pattern[i]);
+        t = addMod61(mulMod61(t, base), (unsigned char)text[i]);
+    }
+    for (size_t i = 0;; i++) {
+        if (p == t && text.compare(i, m, pattern) == 0) onMatch(i);
+        if (i + m >= n) break;
+        // Remove text[i], append text[i + m]
+        t = addMod61(t, RK_MOD - mulMod61(high, (unsigned char)text[i]));
+        t = addMod61(mulMod61(t, base), (unsigned char)text[i + m]);
+    }
+}
+
+// ========================================
+// BASELINE (copies of advanced_problems.cpp / core_problems.cpp, without printing)
+// ========================================
+
+vector<int> rabinKarp(string text, string pattern) {
+    vector<int> found;
+    int d = 256;
+    int q = 101;
+    int m = pattern.length();
+    int n = text.length();
+    int p = 0;
+    int t = 0;
+    int h = 1;
+    if (m == 0 || m > n) return found;
+
+    for (int i = 0; i < m - 1; i++) {
+        h = (h * d) % q;
+    }
+    for (int i = 0; i < m; i++) {
+        p = (d * p + pattern[i]) % q;
+        t = (d * t + text[i]) % q;
+    }
+    for (int i = 0; i <= n - m; i++) {
+        if (p == t) {
+            bool match = true;
+            for (int j = 0; j < m; j++) {
+                if (text[i + j] != pattern[j]) {
+                    match = false;
+                    break;
+                }
+            }
+            if (match) {
+                found.push_back(i);
+            }
+        }
+        if (i < n - m) {
+            t = (d * (t - text[i] * h) + text[i + m]) % q;
+            if (t < 0) {
+                t = (t + q);
+            }
+        }
+    }
+    return found;
+}
+
+// countSubstring, but overlapping (advance by 1) so counts match the automaton
+int countSubstringOverlapping(const string& str, const string& substr) {
+    int count = 0;
+    size_t pos = 0;
+
+    while ((pos = str.find(substr, pos)) != string::npos) {
+        count++;
+        pos += 1;
+    }
+    return count;
+}
+
+// ========================================
+// BENCHMARK: 1 TO 100K PATTERNS
+// ========================================
+// Usage: benchmarkMultiPattern(textBytes)
+// Example: benchmarkMultiPattern(1 << 24) - 16 MB of text
+void benchmarkMultiPattern(size_t textBytes) {
+    using Clock = chrono::steady_clock;
+    auto seconds = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // Word-like text over 26 letters plus spaces
+    mt19937 rng(18);
+    string text(textBytes, ' ');
+    for (size_t i = 0; i < textBytes; i++) {
+        if (rng() % 7 != 0) text[i] = (char)('a' + rng() % 26);
+    }
+
+    cout << "text " << textBytes / (1 << 20) << " MB" << endl;
+    cout << "patterns  states  dense  memKB  buildMs  acMB/s  matches  findLoopMB/s" << endl;
+    for (size_t k : {(size_t)1, (size_t)10, (size_t)100, (size_t)1000, (size_t)10000, (size_t)100000}) {
+        // Patterns of length 4..12: half cut from the text (they occur), half random
+        vector<string> patterns;
+        for (size_t i = 0; i < k; i++) {
+            size_t len = 4 + rng() % 9;
+            if (i % 2 == 0) {
+                patterns.push_back(text.substr(rng() % (textBytes - len), len));
+            } else {
+                string p(len, 'a');
+                for (char& c : p) c = (char)('a' + rng() % 26);
+                patterns.push_back(p);
+            }
+        }
+
+        auto start = Clock::now();
+        AhoCorasick ac(patterns);
+        double buildMs = seconds(start) * 1e3;
+
+        start = Clock::now();
+        size_t matches = ac.countMatches(text);
+        double acRate = textBytes / seconds(start) / 1e6;
+
+        cout << k << "  " << ac.stateCount() << "  " << ac.denseStateCount() << "  "
+             << ac.memoryBytes() / 1024 << "  " << buildMs << "  " << acRate << "  " << matches << "  ";
+
+        // One find() pass per pattern; too slow to run past 1000 patterns
+        if (k <= 1000) {
+            start = Clock::now();
+            size_t findMatches = 0;
+            for (const string& p : patterns) findMatches += countSubstringOverlapping(text, p);
+            double findRate = textBytes / seconds(start) / 1e6;
+            cout << findRate << (findMatches == matches ? "" : "  MISMATCH");
+        } else {
+            cout << "-";
+        }
+        cout << endl;
+    }
+
+    // Single pattern: q = 101 rabinKarp vs 64-bit rabinKarpSearch vs automaton
+    string pattern = text.substr(textBytes / 2, 8);
+    auto start = Clock::now();
+    size_t oldCount = rabinKarp(text, pattern).size();
+    double oldRate = textBytes / seconds(start) / 1e6;
+    start = Clock::now();
+    size_t newCount = 0;
+    rabinKarpSearch(text, pattern, [&](size_t) { newCount++; });
+    double newRate = textBytes / seconds(start) / 1e6;
+    cout << "single pattern MB/s: rabinKarp(q=101) " << oldRate << ", rabinKarpSearch " << newRate
+         << " (" << oldCount << " / " << newCount << " matches)" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Multi-Pattern Search ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Aho-Corasick over several patterns
+    // vector<string> patterns = {"he", "she", "his", "hers"};
+    // AhoCorasick ac(patterns);
+    // ac.search(str, [&](size_t start, int id) {
+    //     cout << "\"" << patterns[id] << "\" at index " << start << endl;
+    // });
+    // cout << "Total matches: " << ac.countMatches(str) << endl;
+
+    // Text arriving in chunks (a match may span two chunks)
+    // auto stream = ac.stream();
+    // stream.feed(str.substr(0, str.size() / 2), [](size_t start, int id) { cout << id << "@" << start << " "; });
+    // stream.feed(str.substr(str.size() / 2), [](size_t start, int id) { cout << id << "@" << start << " "; });
+    // cout << endl;
+
+    // 2. Single-pattern Rabin-Karp
+    // cout << "Pattern occurrences at indices: ";
+    // rabinKarpSearch(str, "ab", [](size_t start) { cout << start << " "; });
+    // cout << endl;
+
+    // Throughput for 1 to 100K patterns
+    // benchmarkMultiPattern(1 << 24);
+
+    return 0;
+}
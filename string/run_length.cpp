@@ -0,0 +1,596 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#if defined(__x86_64__) || defined(__i386__)
+#define RLE_X86 1
+#include <immintrin.h>
+#else
+#define RLE_X86 0
+#endif
+using namespace std;
+
+// ========================================
+// RUN-LENGTH CODEC
+// ========================================
+// Concept: encode / decode (advanced_problems.cpp) grow the output one
+// to_string(count) += at a time. This codec does the same job in two
+// formats:
+// - TEXT:   "<decimal count><byte>" per run, the same output as encode().
+//           Like encode(), it cannot round-trip input containing digits
+// - BINARY: "<varint(count - 1)><byte>" per run, LEB128 (7 bits per byte,
+//           high bit = more). Any bytes round-trip; a run of up to 128
+//           costs 2 bytes, so sparse bitmaps (long zero runs) shrink a lot
+// Run boundaries are found 16 (SSE2) or 32 (AVX2) bytes at a time by
+// comparing the input with itself shifted by one byte: each 0 bit in
+// the compare mask starts a new run, and long runs cost one compare per
+// block. One-shot calls first compute the exact output size (a second
+// cheap pass), so each call allocates once. RleEncoder / RleDecoder take
+// the input in chunks of any size and carry a run (or a half-read count)
+// across chunk boundaries. The instruction set is picked at runtime;
+// setSimdLevel caps it.
+
+enum class SimdLevel { SCALAR = 0, SSE2 = 1, AVX2 = 2 };
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+SimdLevel detectSimdLevel() {
+#if RLE_X86 && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+SimdLevel simdLevelCap = SimdLevel::AVX2;
+
+// Usage: setSimdLevel(SimdLevel::SSE2) - never use anything above SSE2
+void setSimdLevel(SimdLevel level) {
+    simdLevelCap = level;
+}
+
+SimdLevel currentSimdLevel() {
+    static const SimdLevel detected = detectSimdLevel();
+    return min(detected, simdLevelCap);
+}
+
+enum class RleFormat { TEXT, BINARY };
+
+// Returned by rleDecodedSize for input that is not a valid encoding
+const size_t RLE_MALFORMED = string::npos;
+
+// ========================================
+// SCALAR KERNEL
+// ========================================
+// emit(byte, length) for every maximal run of s[0, n), in order.
+// Eight bytes at a time: XOR with the input shifted by one is zero
+// inside a run.
+namespace scalar {
+
+template <typename Emit>
+void forEachRun(const char* s, size_t n, Emit& emit) {
+    if (n == 0) return;
+    size_t start = 0, i = 1;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t a, b;
+        memcpy(&a, s + i, 8);
+        memcpy(&b, s + i - 1, 8);
+        if (a == b) continue;
+        for (size_t k = i; k < i + 8; k++) {
+            if (s[k] != s[k - 1]) {
+                emit((unsigned char)s[start], k - start);
+                start = k;
+            }
+        }
+    }
+    for (; i < n; i++) {
+        if (s[i] != s[i - 1]) {
+            emit((unsigned char)s[start], i - start);
+            start = i;
+        }
+    }
+    emit((unsigned char)s[start], n - start);
+}
+
+}  // namespace scalar
+
+#if RLE_X86
+
+// Each ISA namespace defines ByteOps with: V, WIDTH, load, eq, mask (one
+// bit per byte). Bit k of the "changed" mask is set when s[i+k] differs
+// from s[i+k-1], i.e. a run starts at i+k.
+#define DEFINE_RLE_KERNELS                                                      \
+template <typename Ops, typename Emit>                                          \
+void forEachRun(const char* s, size_t n, Emit& emit) {                          \
+    if (n == 0) return;                                                         \
+    const size_t W = Ops::WIDTH;                                                \
+    const uint32_t all = (uint32_t)((1ULL << W) - 1);                           \
+    size_t start = 0, i = 1;                                                    \
+    for (; i + W <= n; i += W) {                                                \
+        uint32_t changed = ~Ops::mask(Ops::eq(Ops::load(s + i), Ops::load(s + i - 1))) & all; \
+        while (changed) {                                                       \
+            size_t at = i + __builtin_ctz(changed);                             \
+            emit((unsigned char)s[start], at - start);                          \
+            start = at;                                                         \
+            changed &= changed - 1;                                             \
+        }                                                                       \
+    }                                                                           \
+    for (; i < n; i++) {                                                        \
+        if (s[i] != s[i - 1]) {                                                 \
+            emit((unsigned char)s[start], i - start);                           \
+            start = i;                                                          \
+        }                                                                       \
+    }                                                                           \
+    emit((unsigned char)s[start], n - start);                                   \
+}
+
+// ========================================
+// SSE2 KERNEL
+// ========================================
+namespace sse2 {
+
+struct ByteOps {
+    typedef __m128i V;
+    static const size_t WIDTH = 16;
+    static V load(const char* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static V eq(V a, V b) { return _mm_cmpeq_epi8(a, b); }
+    static uint32_t mask(V v) { return (uint32_t)_mm_movemask_epi8(v); }
+};
+
+DEFINE_RLE_KERNELS
+
+}  // namespace sse2
+
+// ========================================
+// AVX2 KERNEL
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+
+struct ByteOps {
+    typedef __m256i V;
+    static const size_t WIDTH = 32;
+    static V load(const char* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static V eq(V a, V b) { return _mm256_cmpeq_epi8(a, b); }
+    static uint32_t mask(V v) { return (uint32_t)_mm256_movemask_epi8(v); }
+};
+
+DEFINE_RLE_KERNELS
+
+}  // namespace avx2
+#pragma GCC pop_options
+
+#endif  // RLE_X86
+
+// Usage: forEachRun(s, n, emit) - emit(unsigned char byte, size_t length)
+template <typename Emit>
+void forEachRun(const char* s, size_t n, Emit& emit) {
+#if RLE_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: avx2::forEachRun<avx2::ByteOps>(s, n, emit); return;
+        case SimdLevel::SSE2: sse2::forEachRun<sse2::ByteOps>(s, n, emit); return;
+        default: break;
+    }
+#endif
+    scalar::forEachRun(s, n, emit);
+}
+
+// ========================================
+// RUN ENCODING
+// ========================================
+
+inline size_t varintSize(uint64_t v) {
+    return (63 - __builtin_clzll(v | 1)) / 7 + 1;
+}
+
+inline size_t decimalSize(uint64_t v) {
+    size_t digits = 1;
+    while (v >= 10) {
+        v /= 10;
+        digits++;
+    }
+    return digits;
+}
+
+// Writes one run at o; returns the end. At most 21 bytes.
+inline char* putRun(char* o, unsigned char byte, uint64_t length, RleFormat format) {
+    if (format == RleFormat::BINARY) {
+        uint64_t v = length - 1;
+        while (v >= 0x80) {
+            *o++ = (char)(v | 0x80);
+            v >>= 7;
+        }
+        *o++ = (char)v;
+    } else {
+        char digits[20];
+        size_t k = 0;
+        do {
+            digits[k++] = (char)('0' + length % 10);
+            length /= 10;
+        } while (length);
+        while (k) *o++ = digits[--k];
+    }
+    *o++ = (char)byte;
+    return o;
+}
+
+// ========================================
+// 1. ONE-SHOT ENCODE
+// ========================================
+// Usage: size = rleEncodedSize(s, n, format) - exact, no allocation
+//        used = rleEncodeTo(s, n, out, format) - out needs size bytes
+//        encoded = rleEncode(str [, format]) - allocates once
+// Example: rleEncode("aaabbcccc", RleFormat::TEXT) returns "3a2b4c";
+//          rleEncode("aaabbcccc") returns "\x02a\x01b\x03c"
+size_t rleEncodedSize(const char* s, size_t n, RleFormat format) {
+    size_t total = 0;
+    if (format == RleFormat::BINARY) {
+        auto add = [&](unsigned char, size_t length) { total += varintSize(length - 1) + 1; };
+        forEachRun(s, n, add);
+    } else {
+        auto add = [&](unsigned char, size_t length) { total += decimalSize(length) + 1; };
+        forEachRun(s, n, add);
+    }
+    return total;
+}
+
+size_t rleEncodeTo(const char* s, size_t n, char* out, RleFormat format) {
+    char* o = out;
+    auto put = [&](unsigned char byte, size_t length) { o = putRun(o, byte, length, format); };
+    forEachRun(s, n, put);
+    return o - out;
+}
+
+string rleEncode(string_view s, RleFormat format = RleFormat::BINARY) {
+    string out(rleEncodedSize(s.data(), s.size(), format), '\0');
+    rleEncodeTo(s.data(), s.size(), &out[0], format);
+    return out;
+}
+
+// ========================================
+// 2. STREAMING ENCODER
+// ========================================
+// Usage: RleEncoder enc(format); enc.feed(chunk, n, out) ...; enc.finish(out)
+// The last run of each chunk is held back, since the next chunk may
+// continue it; finish() writes it. Output is byte-identical to rleEncode
+// of the concatenated chunks.
+class RleEncoder {
+public:
+    explicit RleEncoder(RleFormat format = RleFormat::BINARY) : format(format) {}
+
+    void feed(const char* data, size_t n, string& out) {
+        auto run = [&](unsigned char byte, size_t length) {
+            if (pending && byte == pendingByte) {
+                pending += length;  // only the first run of a chunk can merge
+                return;
+            }
+            if (pending) append(out);
+            pendingByte = byte;
+            pending = length;
+        };
+        forEachRun(data, n, run);
+    }
+
+    void finish(string& out) {
+        if (pending) append(out);
+        pending = 0;
+    }
+
+private:
+    RleFormat format;
+    unsigned char pendingByte = 0;
+    uint64_t pending = 0;  // length of the held-back run, 0 if none
+
+    void append(string& out) {
+        char buf[24];
+        out.append(buf, putRun(buf, pendingByte, pending, format) - buf);
+    }
+};
+
+// ========================================
+// 3. DECODER (STREAMING AND ONE-SHOT)
+// ========================================
+// Usage: RleDecoder dec(format);
+//        if (!dec.feed(chunk, n, out)) ... malformed
+//        if (!dec.finish()) ... input ended inside a run
+// A count may be split across chunks; the decoder keeps the digits (or
+// varint bits) read so far. Counts that overflow 64 bits are malformed.
+class RleDecoder {
+public:
+    explicit RleDecoder(RleFormat format = RleFormat::BINARY) : format(format) {}
+
+    bool feed(const char* data, size_t n, string& out) {
+        auto write = [&](unsigned char byte, uint64_t length) { out.append(length, (char)byte); };
+        return parse(data, n, write);
+    }
+
+    // True if the input so far ended on a run boundary
+    bool finish() const { return !inCount; }
+
+    // emit(byte, length) for each complete run; false on malformed input
+    template <typename Emit>
+    bool parse(const char* data, size_t n, Emit& emit) {
+        const unsigned char* p = (const unsigned char*)data;
+        if (format == RleFormat::BINARY) {
+            for (size_t i = 0; i < n; i++) {
+                unsigned b = p[i];
+                if (awaitingByte) {
+                    emit(b, count + 1);
+                    count = 0;
+                    shift = 0;
+                    awaitingByte = inCount = false;
+                    continue;
+                }
+                // The 10th varint byte may only hold the top bit
+                if (shift == 63 && b > 1) return false;
+                count |= (uint64_t)(b & 0x7F) << shift;
+                inCount = true;
+                if (b & 0x80) {
+                    shift += 7;
+                } else {
+                    if (count == UINT64_MAX) return false;  // count + 1 overflows
+                    awaitingByte = true;
+                }
+            }
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                unsigned b = p[i];
+                if (b >= '0' && b <= '9') {
+                    if (count > (UINT64_MAX - 9) / 10) return false;
+                    count = count * 10 + (b - '0');
+                    inCount = true;
+                } else {
+                    if (count) emit(b, count);
+                    count = 0;
+                    inCount = false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    RleFormat format;
+    uint64_t count = 0;
+    unsigned shift = 0;
+    bool inCount = false;       // part of a run has been read
+    bool awaitingByte = false;  // BINARY: count complete, byte next
+};
+
+// Usage: size = rleDecodedSize(enc, n, format) - exact, or RLE_MALFORMED
+size_t rleDecodedSize(const char* in, size_t n, RleFormat format) {
+    RleDecoder dec(format);
+    size_t total = 0;
+    bool overflow = false;
+    auto add = [&](unsigned char, uint64_t length) {
+        overflow |= length > SIZE_MAX - 1 - total;
+        total += length;
+    };
+    if (!dec.parse(in, n, add) || !dec.finish() || overflow) return RLE_MALFORMED;
+    return total;
+}
+
+// Usage: if (rleDecode(encoded, out [, format])) ... - allocates once
+// Example: rleDecode("3a2b4c", out, RleFormat::TEXT) gives out = "aaabbcccc"
+bool rleDecode(string_view in, string& out, RleFormat format = RleFormat::BINARY) {
+    size_t size = rleDecodedSize(in.data(), in.size(), format);
+    if (size == RLE_MALFORMED) return false;
+    out.assign(size, '\0');
+    char* o = &out[0];
+    char* end = o + size;
+    auto write = [&](unsigned char byte, uint64_t length) {
+        if (length <= 16 && end - o >= 16) {
+            // Short run: two unconditional 8-byte stores beat a memset call
+            uint64_t v = byte * 0x0101010101010101ULL;
+            memcpy(o, &v, 8);
+            memcpy(o + 8, &v, 8);
+        } else {
+            memset(o, byte, length);
+        }
+        o += length;
+    };
+    RleDecoder dec(format);
+    dec.parse(in.data(), in.size(), write);
+    return true;
+}
+
+// ========================================
+// BASELINE (copies of advanced_problems.cpp)
+// ========================================
+
+string encode(string str) {
+    if (str.empty()) return "";
+
+    string result = "";
+    int count = 1;
+
+    for (int i = 1; i < (int)str.length(); i++) {
+        if (str[i] == str[i - 1]) {
+            count++;
+        } else {
+            result += to_string(count) + str[i - 1];
+            count = 1;
+        }
+    }
+    result += to_string(count) + str[str.length() - 1];
+
+    return result;
+}
+
+string decode(string str) {
+    string result = "";
+    int i = 0;
+
+    while (i < (int)str.length()) {
+        int count = 0;
+        while (i < (int)str.length() && isdigit(str[i])) {
+            count = count * 10 + (str[i] - '0');
+            i++;
+        }
+        if (i < (int)str.length()) {
+            result += string(count, str[i]);
+            i++;
+        }
+    }
+
+    return result;
+}
+
+// ========================================
+// BENCHMARK: GB/s
+// ========================================
+// Usage: benchmarkRunLength(bytes)
+// Example: benchmarkRunLength(1 << 26) - 64 MB inputs
+// Inputs: bitmaps with one bit in 1000 and one in 100000 set (the
+// codec's target), and 4-letter text with runs of ~1.3 (worst case).
+// Throughput is input bytes (encode) or decoded bytes (decode) per second.
+void benchmarkRunLength(size_t bytes) {
+    using Clock = chrono::steady_clock;
+    auto gbps = [&](size_t n, auto&& body) {
+        auto start = Clock::now();
+        size_t reps = 0;
+        double secs;
+        do {
+            body();
+            reps++;
+            secs = chrono::duration<double>(Clock::now() - start).count();
+        } while (secs < 0.2);
+        return (double)reps * n / secs / 1e9;
+    };
+
+    mt19937_64 rng(25);
+    auto bitmap = [&](double density) {
+        string s(bytes, '\0');
+        size_t bits = (size_t)(bytes * 8 * density);
+        for (size_t k = 0; k < bits; k++) {
+            size_t bit = rng() % (bytes * 8);
+            s[bit / 8] |= (char)(1 << (bit % 8));
+        }
+        return s;
+    };
+    string letters(bytes, 'a');
+    for (char& c : letters) c = "acgt"[rng() % 4];
+
+    struct Input {
+        const char* name;
+        string data;
+    };
+    vector<Input> inputs;
+    inputs.push_back({"bitmap 1e-3", bitmap(1e-3)});
+    inputs.push_back({"bitmap 1e-5", bitmap(1e-5)});
+    inputs.push_back({"acgt text", letters});
+
+    cout << "Detected SIMD level: " << simdLevelName(detectSimdLevel()) << endl;
+    size_t sink = 0;
+    for (const Input& in : inputs) {
+        const string& s = in.data;
+        size_t n = s.size();
+        string bin = rleEncode(s), txt = rleEncode(s, RleFormat::TEXT);
+        cout << in.name << ": " << n << " bytes -> binary " << bin.size() << ", text " << txt.size() << endl;
+
+        double encodeOrig = gbps(n, [&] { sink += encode(s).size(); });
+        double decodeOrig = gbps(n, [&] { sink += decode(txt).size(); });
+        cout << "  encode original " << encodeOrig << ", decode original " << decodeOrig << " GB/s" << endl;
+
+        for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+            if (level > detectSimdLevel()) continue;
+            setSimdLevel(level);
+            double size = gbps(n, [&] { sink += rleEncodedSize(s.data(), n, RleFormat::BINARY); });
+            double enc = gbps(n, [&] { sink += rleEncode(s).size(); });
+            double encTxt = gbps(n, [&] { sink += rleEncode(s, RleFormat::TEXT).size(); });
+            cout << "  " << simdLevelName(level) << ": size " << size << ", encode binary " << enc
+                 << ", encode text " << encTxt << " GB/s" << endl;
+        }
+        setSimdLevel(SimdLevel::AVX2);
+
+        string out;
+        double dec = gbps(n, [&] { rleDecode(bin, out); sink += out.size(); });
+        double decTxt = gbps(n, [&] { rleDecode(txt, out, RleFormat::TEXT); sink += out.size(); });
+        // The text format only round-trips input without digit bytes
+        bool ok = out == s || any_of(s.begin(), s.end(), [](char c) { return c >= '0' && c <= '9'; });
+        rleDecode(bin, out);
+        ok &= out == s && encode(s) == txt;
+
+        // 64 KB chunks through the streaming coder
+        const size_t CHUNK = 1 << 16;
+        string streamed, restored;
+        double streamEnc = gbps(n, [&] {
+            RleEncoder enc;
+            streamed.clear();
+            for (size_t i = 0; i < n; i += CHUNK) enc.feed(s.data() + i, min(CHUNK, n - i), streamed);
+            enc.finish(streamed);
+        });
+        double streamDec = gbps(n, [&] {
+            RleDecoder dec;
+            restored.clear();
+            for (size_t i = 0; i < streamed.size(); i += CHUNK) {
+                dec.feed(streamed.data() + i, min(CHUNK, streamed.size() - i), restored);
+            }
+        });
+        ok &= streamed == bin && restored == s;
+        cout << "  decode binary " << dec << ", decode text " << decTxt << ", stream encode " << streamEnc
+             << ", stream decode " << streamDec << " GB/s (checksum " << sink << ")"
+             << (ok ? "" : "  MISMATCH") << endl;
+    }
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Run-Length Codec ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Text format (same output as encode())
+    // string encoded = rleEncode(str, RleFormat::TEXT);
+    // cout << "Encoded: " << encoded << endl;
+    // string decoded;
+    // rleDecode(encoded, decoded, RleFormat::TEXT);
+    // cout << "Decoded: " << decoded << endl;
+
+    // 2. Binary format (any bytes, varint counts)
+    // string packed = rleEncode(str);
+    // cout << "Binary: " << packed.size() << " bytes (exact size computed first: "
+    //      << rleEncodedSize(str.data(), str.size(), RleFormat::BINARY) << ")" << endl;
+
+    // 3. Streaming, chunk by chunk
+    // RleEncoder enc;
+    // string out;
+    // enc.feed(str.data(), str.size() / 2, out);
+    // enc.feed(str.data() + str.size() / 2, str.size() - str.size() / 2, out);
+    // enc.finish(out);
+    // RleDecoder dec;
+    // string back;
+    // if (dec.feed(out.data(), out.size(), back) && dec.finish()) {
+    //     cout << "Round trip: " << (back == str ? "ok" : "failed") << endl;
+    // }
+
+    // Throughput in GB/s
+    // benchmarkRunLength(1 << 26);
+
+    return 0;
+}
@@ -0,0 +1,630 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#if defined(__x86_64__) || defined(__i386__)
+#define TEXT_X86 1
+#include <immintrin.h>
+#else
+#define TEXT_X86 0
+#endif
+using namespace std;
+
+// ========================================
+// SIMD TEXT KERNELS
+// ========================================
+// Concept: Vectorized versions of the per-character loops in
+// basic_operations.cpp (toUpperCase, toLowerCase, replaceChar) and
+// core_problems.cpp (toggleCase, countVowelsConsonants, charFrequency)
+// - 16 (SSE4.2) or 32 (AVX2) bytes per step, picked at runtime from the
+//   CPU's feature bits; anything else uses the scalar path
+// - Case kernels only touch bytes 'A'-'Z' / 'a'-'z'. Every byte of a
+//   multi-byte UTF-8 sequence is >= 0x80 (negative as a signed char), so
+//   it never falls in those ranges and UTF-8 text passes through unchanged
+// - validateUtf8 skips whole all-ASCII blocks with one compare and
+//   drops to the scalar decoder only around non-ASCII bytes
+// - ByteHistogram counts all 256 byte values in one pass, so many
+//   frequency queries on the same text cost one scan
+
+enum class SimdLevel { SCALAR = 0, SSE42 = 1, AVX2 = 2 };
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE42: return "sse4.2";
+        default: return "scalar";
+    }
+}
+
+SimdLevel detectSimdLevel() {
+#if TEXT_X86 && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) return SimdLevel::SSE42;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+// Highest level the caller allows (used by the benchmark to compare paths)
+SimdLevel simdLevelCap = SimdLevel::AVX2;
+
+// Usage: setSimdLevel(SimdLevel::SSE42) - never use anything above SSE4.2
+void setSimdLevel(SimdLevel level) {
+    simdLevelCap = level;
+}
+
+SimdLevel currentSimdLevel() {
+    static const SimdLevel detected = detectSimdLevel();
+    return min(detected, simdLevelCap);
+}
+
+enum CaseMode { TO_UPPER, TO_LOWER, TOGGLE };
+
+struct VowelConsonantCount {
+    size_t vowels;
+    size_t consonants;
+};
+
+// One UTF-8 sequence starting at s[i] (s[i] >= 0x80). Returns the index
+// after it, or 0 if it is malformed: overlong forms, surrogates
+// (U+D800-DFFF) and values above U+10FFFF are rejected.
+inline size_t utf8Step(const unsigned char* s, size_t n, size_t i) {
+    unsigned c = s[i];
+    auto cont = [&](size_t k, unsigned lo, unsigned hi) {
+        return i + k < n && s[i + k] >= lo && s[i + k] <= hi;
+    };
+    if (c < 0xC2) return 0;
+    if (c < 0xE0) return cont(1, 0x80, 0xBF) ? i + 2 : 0;
+    if (c < 0xF0) {
+        unsigned lo = c == 0xE0 ? 0xA0 : 0x80, hi = c == 0xED ? 0x9F : 0xBF;
+        return cont(1, lo, hi) && cont(2, 0x80, 0xBF) ? i + 3 : 0;
+    }
+    if (c < 0xF5) {
+        unsigned lo = c == 0xF0 ? 0x90 : 0x80, hi = c == 0xF4 ? 0x8F : 0xBF;
+        return cont(1, lo, hi) && cont(2, 0x80, 0xBF) && cont(3, 0x80, 0xBF) ? i + 4 : 0;
+    }
+    return 0;
+}
+
+// ========================================
+// SCALAR KERNELS
+// ========================================
+namespace scalar {
+
+template <int Mode>
+void convertCase(char* s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        char c = s[i];
+        char folded = (char)(c | 0x20);
+        bool hit;
+        if (Mode == TO_UPPER) hit = c >= 'a' && c <= 'z';
+        else if (Mode == TO_LOWER) hit = c >= 'A' && c <= 'Z';
+        else hit = folded >= 'a' && folded <= 'z';
+        s[i] = (char)(c ^ (hit ? 0x20 : 0));
+    }
+}
+
+size_t replaceChar(char* s, size_t n, char oldChar, char newChar) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        bool hit = s[i] == oldChar;
+        count += hit;
+        s[i] = hit ? newChar : s[i];
+    }
+    return count;
+}
+
+size_t countChar(const char* s, size_t n, char ch) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) count += s[i] == ch;
+    return count;
+}
+
+VowelConsonantCount countVowelsConsonants(const char* s, size_t n) {
+    size_t vowels = 0, letters = 0;
+    for (size_t i = 0; i < n; i++) {
+        char c = (char)(s[i] | 0x20);
+        letters += c >= 'a' && c <= 'z';
+        vowels += c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u';
+    }
+    return {vowels, letters - vowels};
+}
+
+bool validateUtf8(const char* text, size_t n) {
+    const unsigned char* s = (const unsigned char*)text;
+    size_t i = 0;
+    while (i < n) {
+        if (s[i] < 0x80) {
+            i++;
+        } else {
+            i = utf8Step(s, n, i);
+            if (i == 0) return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace scalar
+
+#if TEXT_X86
+
+// Kernels shared by every instruction set. Each ISA namespace defines
+// ByteOps with: V, WIDTH, load, store, set1, eq, gt (signed), vand, vor,
+// vxor, blend (b where mask), mask (one bit per byte). The kernels are
+// stamped out once per namespace so each copy is compiled for its target.
+#define DEFINE_TEXT_KERNELS                                                     \
+template <typename Ops>                                                         \
+typename Ops::V inRange(typename Ops::V v, char lo, char hi) {                  \
+    return Ops::vand(Ops::gt(v, Ops::set1((char)(lo - 1))),                     \
+                     Ops::gt(Ops::set1((char)(hi + 1)), v));                    \
+}                                                                               \
+                                                                                \
+template <typename Ops, int Mode>                                               \
+void convertCase(char* s, size_t n) {                                           \
+    const size_t W = Ops::WIDTH;                                                \
+    const typename Ops::V bit = Ops::set1(0x20);                                \
+    size_t i = 0;                                                               \
+    for (; i + W <= n; i += W) {                                                \
+        typename Ops::V v = Ops::load(s + i), hit;                              \
+        if (Mode == TO_UPPER) hit = inRange<Ops>(v, 'a', 'z');                  \
+        else if (Mode == TO_LOWER) hit = inRange<Ops>(v, 'A', 'Z');             \
+        else hit = inRange<Ops>(Ops::vor(v, bit), 'a', 'z');                    \
+        Ops::store(s + i, Ops::vxor(v, Ops::vand(hit, bit)));                   \
+    }                                                                           \
+    scalar::convertCase<Mode>(s + i, n - i);                                    \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+size_t replaceChar(char* s, size_t n, char oldChar, char newChar) {             \
+    const size_t W = Ops::WIDTH;                                                \
+    const typename Ops::V from = Ops::set1(oldChar), to = Ops::set1(newChar);   \
+    size_t count = 0, i = 0;                                                    \
+    for (; i + W <= n; i += W) {                                                \
+        typename Ops::V v = Ops::load(s + i);                                   \
+        typename Ops::V hit = Ops::eq(v, from);                                 \
+        uint32_t m = Ops::mask(hit);                                            \
+        if (m) {                                                                \
+            Ops::store(s + i, Ops::blend(v, to, hit));                          \
+            count += __builtin_popcount(m);                                     \
+        }                                                                       \
+    }                                                                           \
+    return count + scalar::replaceChar(s + i, n - i, oldChar, newChar);         \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+size_t countChar(const char* s, size_t n, char ch) {                            \
+    const size_t W = Ops::WIDTH;                                                \
+    const typename Ops::V key = Ops::set1(ch);                                  \
+    size_t count = 0, i = 0;                                                    \
+    for (; i + 2 * W <= n; i += 2 * W) {                                        \
+        count += __builtin_popcount(Ops::mask(Ops::eq(Ops::load(s + i), key)));  \
+        count += __builtin_popcount(Ops::mask(Ops::eq(Ops::load(s + i + W), key))); \
+    }                                                                           \
+    return count + scalar::countChar(s + i, n - i, ch);                         \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+VowelConsonantCount countVowelsConsonants(const char* s, size_t n) {            \
+    const size_t W = Ops::WIDTH;                                                \
+    const typename Ops::V bit = Ops::set1(0x20);                                \
+    const typename Ops::V a = Ops::set1('a'), e = Ops::set1('e'),               \
+        iv = Ops::set1('i'), o = Ops::set1('o'), u = Ops::set1('u');            \
+    size_t vowels = 0, letters = 0, i = 0;                                      \
+    for (; i + W <= n; i += W) {                                                \
+        typename Ops::V c = Ops::vor(Ops::load(s + i), bit);                    \
+        typename Ops::V vowel = Ops::vor(Ops::vor(Ops::eq(c, a), Ops::eq(c, e)), \
+            Ops::vor(Ops::vor(Ops::eq(c, iv), Ops::eq(c, o)), Ops::eq(c, u)));  \
+        letters += __builtin_popcount(Ops::mask(inRange<Ops>(c, 'a', 'z')));    \
+        vowels += __builtin_popcount(Ops::mask(vowel));                         \
+    }                                                                           \
+    VowelConsonantCount rest = scalar::countVowelsConsonants(s + i, n - i);     \
+    return {vowels + rest.vowels, letters - vowels + rest.consonants};          \
+}                                                                               \
+                                                                                \
+template <typename Ops>                                                         \
+bool validateUtf8(const char* text, size_t n) {                                 \
+    const size_t W = Ops::WIDTH;                                                \
+    const unsigned char* s = (const unsigned char*)text;                        \
+    size_t i = 0;                                                               \
+    while (i + W <= n) {                                                        \
+        uint32_t m = Ops::mask(Ops::load(text + i));                            \
+        if (m == 0) {                                                           \
+            i += W;                                                             \
+            continue;                                                           \
+        }                                                                       \
+        /* Skip the ASCII prefix, decode one sequence, resume in SIMD */        \
+        i = utf8Step(s, n, i + __builtin_ctz(m));                               \
+        if (i == 0) return false;                                               \
+    }                                                                           \
+    if (!scalar::validateUtf8(text + i, n - i)) return false;                   \
+    return true;                                                                \
+}
+
+// ========================================
+// SSE4.2 KERNELS
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("sse4.2,popcnt")
+namespace sse42 {
+
+struct ByteOps {
+    typedef __m128i V;
+    static const size_t WIDTH = 16;
+    static V load(const char* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static void store(char* p, V v) { _mm_storeu_si128((__m128i*)p, v); }
+    static V set1(char c) { return _mm_set1_epi8(c); }
+    static V eq(V a, V b) { return _mm_cmpeq_epi8(a, b); }
+    static V gt(V a, V b) { return _mm_cmpgt_epi8(a, b); }
+    static V vand(V a, V b) { return _mm_and_si128(a, b); }
+    static V vor(V a, V b) { return _mm_or_si128(a, b); }
+    static V vxor(V a, V b) { return _mm_xor_si128(a, b); }
+    static V blend(V a, V b, V m) { return _mm_blendv_epi8(a, b, m); }
+    static uint32_t mask(V v) { return (uint32_t)_mm_movemask_epi8(v); }
+};
+
+DEFINE_TEXT_KERNELS
+
+}  // namespace sse42
+#pragma GCC pop_options
+
+// ========================================
+// AVX2 KERNELS
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+namespace avx2 {
+
+struct ByteOps {
+    typedef __m256i V;
+    static const size_t WIDTH = 32;
+    static V load(const char* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static void store(char* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+    static V set1(char c) { return _mm256_set1_epi8(c); }
+    static V eq(V a, V b) { return _mm256_cmpeq_epi8(a, b); }
+    static V gt(V a, V b) { return _mm256_cmpgt_epi8(a, b); }
+    static V vand(V a, V b) { return _mm256_and_si256(a, b); }
+    static V vor(V a, V b) { return _mm256_or_si256(a, b); }
+    static V vxor(V a, V b) { return _mm256_xor_si256(a, b); }
+    static V blend(V a, V b, V m) { return _mm256_blendv_epi8(a, b, m); }
+    static uint32_t mask(V v) { return (uint32_t)_mm256_movemask_epi8(v); }
+};
+
+DEFINE_TEXT_KERNELS
+
+}  // namespace avx2
+#pragma GCC pop_options
+
+#endif  // TEXT_X86
+
+// ========================================
+// PUBLIC API (RUNTIME DISPATCH)
+// ========================================
+
+template <int Mode>
+void convertCaseSimd(char* s, size_t n) {
+#if TEXT_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: avx2::convertCase<avx2::ByteOps, Mode>(s, n); return;
+        case SimdLevel::SSE42: sse42::convertCase<sse42::ByteOps, Mode>(s, n); return;
+        default: break;
+    }
+#endif
+    scalar::convertCase<Mode>(s, n);
+}
+
+// Usage: toUpperSimd(str) / toLowerSimd(str) / toggleCaseSimd(str) - in place
+// Example: toggleCaseSimd("HeLLo") gives "hEllO"
+void toUpperSimd(char* s, size_t n) { convertCaseSimd<TO_UPPER>(s, n); }
+void toLowerSimd(char* s, size_t n) { convertCaseSimd<TO_LOWER>(s, n); }
+void toggleCaseSimd(char* s, size_t n) { convertCaseSimd<TOGGLE>(s, n); }
+void toUpperSimd(string& str) { toUpperSimd(&str[0], str.size()); }
+void toLowerSimd(string& str) { toLowerSimd(&str[0], str.size()); }
+void toggleCaseSimd(string& str) { toggleCaseSimd(&str[0], str.size()); }
+
+// Usage: count = replaceCharSimd(str, oldChar, newChar) - in place
+// Example: replaceCharSimd("Hello", 'l', 'x') gives "Hexxo", returns 2
+size_t replaceCharSimd(char* s, size_t n, char oldChar, char newChar) {
+#if TEXT_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::replaceChar<avx2::ByteOps>(s, n, oldChar, newChar);
+        case SimdLevel::SSE42: return sse42::replaceChar<sse42::ByteOps>(s, n, oldChar, newChar);
+        default: break;
+    }
+#endif
+    return scalar::replaceChar(s, n, oldChar, newChar);
+}
+size_t replaceCharSimd(string& str, char oldChar, char newChar) {
+    return replaceCharSimd(&str[0], str.size(), oldChar, newChar);
+}
+
+// Usage: freq = charFrequencySimd(str, ch)
+// Example: charFrequencySimd("hello", 'l') returns 2
+size_t charFrequencySimd(const char* s, size_t n, char ch) {
+#if TEXT_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::countChar<avx2::ByteOps>(s, n, ch);
+        case SimdLevel::SSE42: return sse42::countChar<sse42::ByteOps>(s, n, ch);
+        default: break;
+    }
+#endif
+    return scalar::countChar(s, n, ch);
+}
+size_t charFrequencySimd(const string& str, char ch) { return charFrequencySimd(str.data(), str.size(), ch); }
+
+// Usage: c = countVowelsConsonantsSimd(str); c.vowels, c.consonants
+// Example: "hello" gives vowels 2, consonants 3
+VowelConsonantCount countVowelsConsonantsSimd(const char* s, size_t n) {
+#if TEXT_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::countVowelsConsonants<avx2::ByteOps>(s, n);
+        case SimdLevel::SSE42: return sse42::countVowelsConsonants<sse42::ByteOps>(s, n);
+        default: break;
+    }
+#endif
+    return scalar::countVowelsConsonants(s, n);
+}
+VowelConsonantCount countVowelsConsonantsSimd(const string& str) {
+    return countVowelsConsonantsSimd(str.data(), str.size());
+}
+
+// Usage: ok = validateUtf8(str) - true if str is well-formed UTF-8
+// Example: validateUtf8("caf\xC3\xA9") is true, validateUtf8("\xC3") is false
+bool validateUtf8(const char* s, size_t n) {
+#if TEXT_X86
+    switch (currentSimdLevel()) {
+        case SimdLevel::AVX2: return avx2::validateUtf8<avx2::ByteOps>(s, n);
+        case SimdLevel::SSE42: return sse42::validateUtf8<sse42::ByteOps>(s, n);
+        default: break;
+    }
+#endif
+    return scalar::validateUtf8(s, n);
+}
+bool validateUtf8(const string& str) { return validateUtf8(str.data(), str.size()); }
+
+// ========================================
+// BYTE HISTOGRAM
+// ========================================
+// Concept: counts[b] = occurrences of byte b. The scan spreads increments
+// over four sub-tables so consecutive equal bytes do not wait on each
+// other's read-modify-write; the 4 KB of tables stay in L1.
+// add() accumulates, so text can be fed in chunks.
+// Usage: ByteHistogram h; h.add(str); h.count('l'); h.vowels()
+struct ByteHistogram {
+    uint64_t counts[256] = {0};
+
+    void add(const char* text, size_t n) {
+        const unsigned char* s = (const unsigned char*)text;
+        // uint32 sub-counts cannot overflow within one segment
+        const size_t SEGMENT = (size_t)1 << 30;
+        uint32_t t[4][256];
+        for (size_t start = 0; start < n; start += SEGMENT) {
+            size_t end = min(n, start + SEGMENT);
+            memset(t, 0, sizeof(t));
+            size_t i = start;
+            for (; i + 8 <= end; i += 8) {
+                uint64_t w;
+                memcpy(&w, s + i, 8);
+                t[0][w & 0xFF]++;
+                t[1][(w >> 8) & 0xFF]++;
+                t[2][(w >> 16) & 0xFF]++;
+                t[3][(w >> 24) & 0xFF]++;
+                t[0][(w >> 32) & 0xFF]++;
+                t[1][(w >> 40) & 0xFF]++;
+                t[2][(w >> 48) & 0xFF]++;
+                t[3][w >> 56]++;
+            }
+            for (; i < end; i++) t[0][s[i]]++;
+            for (int b = 0; b < 256; b++) counts[b] += (uint64_t)t[0][b] + t[1][b] + t[2][b] + t[3][b];
+        }
+    }
+    void add(const string& str) { add(str.data(), str.size()); }
+
+    uint64_t count(char ch) const { return counts[(unsigned char)ch]; }
+
+    uint64_t letters() const {
+        uint64_t total = 0;
+        for (int c = 'a'; c <= 'z'; c++) total += counts[c] + counts[c - 32];
+        return total;
+    }
+
+    uint64_t vowels() const {
+        uint64_t total = 0;
+        for (char c : {'a', 'e', 'i', 'o', 'u'}) total += counts[(int)c] + counts[c - 32];
+        return total;
+    }
+
+    uint64_t consonants() const { return letters() - vowels(); }
+
+    // Same byte counts (anagram check on bytes)
+    bool operator==(const ByteHistogram& other) const {
+        return memcmp(counts, other.counts, sizeof(counts)) == 0;
+    }
+};
+
+// ========================================
+// BASELINE (per-character loops from basic_operations.cpp / core_problems.cpp)
+// ========================================
+// In place on a buffer so only the per-character work is measured.
+
+void toUpperBaseline(char* s, size_t n) {
+    transform(s, s + n, s, [](unsigned char c) { return (char)toupper(c); });
+}
+
+void toggleCaseBaseline(char* s, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        unsigned char c = s[i];
+        if (isupper(c)) {
+            s[i] = (char)tolower(c);
+        } else if (islower(c)) {
+            s[i] = (char)toupper(c);
+        }
+    }
+}
+
+size_t replaceCharBaseline(char* s, size_t n, char oldChar, char newChar) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] == oldChar) {
+            s[i] = newChar;
+            count++;
+        }
+    }
+    return count;
+}
+
+VowelConsonantCount countVowelsConsonantsBaseline(const char* s, size_t n) {
+    size_t vowels = 0, consonants = 0;
+    for (size_t i = 0; i < n; i++) {
+        char ch = (char)tolower((unsigned char)s[i]);
+        if (ch >= 'a' && ch <= 'z') {
+            if (ch == 'a' || ch == 'e' || ch == 'i' || ch == 'o' || ch == 'u') {
+                vowels++;
+            } else {
+                consonants++;
+            }
+        }
+    }
+    return {vowels, consonants};
+}
+
+size_t charFrequencyBaseline(const char* s, size_t n, char ch) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] == ch) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// ========================================
+// BENCHMARK: GB/s PER KERNEL AND ISA
+// ========================================
+// Usage: benchmarkTextKernels(bytes)
+// Example: benchmarkTextKernels(1 << 28) - 32 KB (L1/L2) and 256 MB of log text
+void benchmarkTextKernels(size_t bytes) {
+    using Clock = chrono::steady_clock;
+    cout << "Detected SIMD level: " << simdLevelName(detectSimdLevel()) << endl;
+    cout << "bytes  kernel      original  scalar  sse4.2  avx2 (GB/s)" << endl;
+
+    // Log-like text; about one line in 8 carries a 2-byte UTF-8 character
+    mt19937 rng(17);
+    const char* words[] = {"INFO", "WARN", "request", "user=", "path=/api/v1/items", "status=200",
+                           "latency_ms=", "Connection", "reset", "caf\xC3\xA9"};
+    string text;
+    text.reserve(bytes + 64);
+    while (text.size() < bytes) {
+        text += words[rng() % 10];
+        text += (rng() % 12 == 0) ? '\n' : ' ';
+    }
+    text.resize(bytes);
+    // Do not end inside a multi-byte sequence
+    while (!text.empty() && (unsigned char)text.back() >= 0x80) text.pop_back();
+
+    const char* names[] = {"upper", "toggle", "replace", "count", "vowels", "utf8", "histogram"};
+    SimdLevel levels[] = {SimdLevel::SCALAR, SimdLevel::SSE42, SimdLevel::AVX2};
+    size_t sink = 0;
+
+    for (size_t n : {min<size_t>(32768, text.size()), text.size()}) {
+        string buf = text.substr(0, n);
+        char* s = &buf[0];
+        size_t reps = max<size_t>(1, ((size_t)1 << 30) / n);
+        auto gbps = [&](auto&& body) {
+            auto start = Clock::now();
+            for (size_t r = 0; r < reps; r++) body();
+            double secs = chrono::duration<double>(Clock::now() - start).count();
+            return (double)reps * n / secs / 1e9;
+        };
+
+        for (int k = 0; k < 7; k++) {
+            cout << n << "  " << names[k] << "  ";
+            // Original per-character loop (no baseline for the new utf8 / histogram kernels)
+            switch (k) {
+                case 0: cout << gbps([&] { toUpperBaseline(s, n); }); break;
+                case 1: cout << gbps([&] { toggleCaseBaseline(s, n); }); break;
+                case 2: cout << gbps([&] { sink += replaceCharBaseline(s, n, 'e', '3'); swap(s[0], s[1]); }); break;
+                case 3: cout << gbps([&] { sink += charFrequencyBaseline(s, n, 'e'); }); break;
+                case 4: cout << gbps([&] { sink += countVowelsConsonantsBaseline(s, n).vowels; }); break;
+                default: cout << "-"; break;
+            }
+            cout << "  ";
+            // The histogram has no ISA-specific path; it is timed once
+            for (SimdLevel level : levels) {
+                if (k == 6 && level != SimdLevel::SCALAR) {
+                    cout << "-  ";
+                    continue;
+                }
+                setSimdLevel(level);
+                double rate = 0;
+                switch (k) {
+                    case 0: rate = gbps([&] { toUpperSimd(s, n); }); break;
+                    case 1: rate = gbps([&] { toggleCaseSimd(s, n); }); break;
+                    case 2: rate = gbps([&] { sink += replaceCharSimd(s, n, 'e', '3'); swap(s[0], s[1]); }); break;
+                    case 3: rate = gbps([&] { sink += charFrequencySimd(s, n, 'e'); }); break;
+                    case 4: rate = gbps([&] { sink += countVowelsConsonantsSimd(s, n).vowels; }); break;
+                    case 5: rate = gbps([&] { sink += validateUtf8(s, n); }); break;
+                    case 6: rate = gbps([&] {
+                        ByteHistogram h;
+                        h.add(s, n);
+                        sink += h.count('e');
+                    }); break;
+                }
+                cout << rate << "  ";
+            }
+            cout << endl;
+        }
+    }
+    setSimdLevel(SimdLevel::AVX2);
+    cout << "(checksum " << sink << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== SIMD Text Kernels ===" << endl;
+    cout << "Detected SIMD level: " << simdLevelName(detectSimdLevel()) << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // Case conversion in place
+    // toUpperSimd(str);
+    // toLowerSimd(str);
+    // toggleCaseSimd(str);
+    // cout << "String: \"" << str << "\"" << endl;
+
+    // Replace and count
+    // cout << "Replaced: " << replaceCharSimd(str, 'l', 'x') << endl;
+    // cout << "Frequency of 'x': " << charFrequencySimd(str, 'x') << endl;
+    // VowelConsonantCount vc = countVowelsConsonantsSimd(str);
+    // cout << "Vowels: " << vc.vowels << ", Consonants: " << vc.consonants << endl;
+
+    // UTF-8 check
+    // cout << "Valid UTF-8: " << (validateUtf8(str) ? "yes" : "no") << endl;
+
+    // One histogram for many frequency queries
+    // ByteHistogram h;
+    // h.add(str);
+    // cout << "'l': " << h.count('l') << ", vowels: " << h.vowels() << endl;
+
+    // Force a code path
+    // setSimdLevel(SimdLevel::SSE42);
+
+    // Throughput
+    // benchmarkTextKernels(1 << 28);
+
+    return 0;
+}
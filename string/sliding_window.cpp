@@ -0,0 +1,487 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+using namespace std;
+
+// ========================================
+// STREAMING SLIDING WINDOWS
+// ========================================
+// Concept: longestUniqueSubstring, minWindowSubstring and
+// longestRepeatingReplacement (advanced_problems.cpp) are all the same
+// two-pointer loop over a whole string, each with its own hash map.
+// Here the loop is written once:
+// - WindowStream<Rule> takes bytes chunk by chunk (positions are 64-bit,
+//   so the stream can be unbounded) and keeps the bytes of the current
+//   window in a growable ring buffer, so the left edge can advance after
+//   the chunk it came from is gone
+// - A Rule holds 256-entry tables (one counter or position per byte
+//   value) instead of an unordered_map and says whether the current
+//   window is valid
+// - "Longest" rules shrink until the window is valid and report it, so
+//   every input byte produces one callback with (start, length).
+//   "Shortest" rules report only minimal windows: the shortest valid
+//   window ending at the byte just fed, and only when its start moved
+//   past the last one reported (or it is the first). Bytes that don't
+//   move the start, and everything before the first valid window,
+//   produce no callback. Answers are a max / min over the reports
+// Memory is the 256-entry tables plus the bytes of the current window;
+// the pattern rule keeps positions instead, so it is bounded by the
+// pattern however long the stream goes without a cover.
+
+// ========================================
+// FRAMEWORK
+// ========================================
+// A Rule provides:
+//   static constexpr bool SHORTEST;   // false: longest windows, true: shortest
+//   static constexpr bool JUMPS;      // see below
+//   void add(uint8_t c); void remove(uint8_t c);
+//   bool valid(uint64_t length) const;
+// A rule whose best start follows from positions alone sets JUMPS and
+// provides instead
+//   uint64_t addAt(uint8_t c, uint64_t pos, uint64_t start);  // new start
+// so the window's bytes are never stored or replayed. A shortest JUMPS
+// rule still provides valid(). It is asked once after each addAt and
+// must return true only when the returned start moved, so reports match
+// the stored-window path.
+// Usage: WindowStream<UniqueBytesRule> s;
+//        s.feed(chunk, [](uint64_t start, uint64_t length) { ... });
+template <typename Rule>
+class WindowStream {
+public:
+    explicit WindowStream(Rule r = Rule()) : rule(r), ring(256) {}
+
+    // Longest rules: reports, for every byte fed, the longest valid window
+    // ending at it. Shortest rules: reports the shortest valid window
+    // ending at the byte only when its start lies past the previous
+    // report's, so most bytes may produce no callback.
+    template <typename Callback>
+    void feed(const char* data, size_t n, Callback&& onWindow) {
+        const uint8_t* p = (const uint8_t*)data;
+        // Work on locals: byte stores into the ring may alias any member
+        uint64_t s = start, e = end;
+        uint8_t* buf = ring.data();
+        uint64_t mask = ring.size() - 1;
+        for (size_t i = 0; i < n; i++) {
+            uint8_t c = p[i];
+            if constexpr (Rule::JUMPS) {
+                s = rule.addAt(c, e++, s);
+                if constexpr (Rule::SHORTEST) {
+                    if (!rule.valid(e - s)) continue;
+                }
+                onWindow(s, e - s);
+            } else {
+                if (e - s == ring.size()) {
+                    grow(s, e);
+                    buf = ring.data();
+                    mask = ring.size() - 1;
+                }
+                buf[e & mask] = c;
+                e++;
+                rule.add(c);
+                if constexpr (!Rule::SHORTEST) {
+                    while (!rule.valid(e - s)) rule.remove(buf[s++ & mask]);
+                    onWindow(s, e - s);
+                } else if (rule.valid(e - s)) {
+                    // Shrink past the last valid start; the window is then one byte short
+                    uint64_t lastValid;
+                    do {
+                        lastValid = s;
+                        rule.remove(buf[s++ & mask]);
+                    } while (rule.valid(e - s));
+                    onWindow(lastValid, e - lastValid);
+                }
+            }
+        }
+        start = s;
+        end = e;
+    }
+    template <typename Callback>
+    void feed(string_view chunk, Callback&& onWindow) { feed(chunk.data(), chunk.size(), onWindow); }
+
+    uint64_t position() const { return end; }
+    const Rule& currentRule() const { return rule; }
+
+private:
+    Rule rule;
+    // Bytes of the window stream[start, end), byte at position i stored at
+    // ring[i % ring.size()]; doubles when the window fills it
+    vector<uint8_t> ring;
+    uint64_t start = 0, end = 0;
+
+    void grow(uint64_t s, uint64_t e) {
+        vector<uint8_t> bigger(ring.size() * 2);
+        for (uint64_t i = s; i < e; i++) bigger[i & (bigger.size() - 1)] = ring[i & (ring.size() - 1)];
+        ring.swap(bigger);
+    }
+};
+
+// Tracks the best (longest or shortest) window reported
+struct BestWindow {
+    uint64_t start = 0;
+    uint64_t length = 0;
+    bool found = false;
+
+    void offerLonger(uint64_t s, uint64_t len) {
+        if (!found || len > length) {
+            start = s;
+            length = len;
+            found = true;
+        }
+    }
+    void offerShorter(uint64_t s, uint64_t len) {
+        if (!found || len < length) {
+            start = s;
+            length = len;
+            found = true;
+        }
+    }
+};
+
+// ========================================
+// 1. LONGEST WINDOW WITHOUT REPEATED BYTES
+// ========================================
+// Only the byte just added can repeat, so the window starts right after
+// its previous occurrence (or stays put): next[b] = 1 + last position of b.
+struct UniqueBytesRule {
+    static constexpr bool SHORTEST = false;
+    static constexpr bool JUMPS = true;
+    uint64_t next[256] = {0};
+
+    uint64_t addAt(uint8_t c, uint64_t pos, uint64_t start) {
+        uint64_t s = max(start, next[c]);
+        next[c] = pos + 1;
+        return s;
+    }
+};
+
+// Usage: length = longestUniqueSubstringStream(str)
+// Example: longestUniqueSubstringStream("abcabcbb") returns 3 ("abc")
+uint64_t longestUniqueSubstringStream(string_view str) {
+    WindowStream<UniqueBytesRule> stream;
+    BestWindow best;
+    stream.feed(str, [&](uint64_t s, uint64_t len) { best.offerLonger(s, len); });
+    return best.length;
+}
+
+// ========================================
+// 2. LONGEST WINDOW WITH AT MOST K REPLACEMENTS
+// ========================================
+// Valid when length - (count of the most frequent byte) <= k. The
+// maximum is kept exact in O(1): withCount[v] is how many byte values
+// occur v times, and a removal can only lower the maximum by one, when
+// the last byte value at the maximum loses an occurrence.
+// With exact = false the maximum is never lowered (the trick the
+// original uses): windows are then only dropped one byte at a time, and
+// some reported windows need more than k replacements, but the longest
+// length reported is still the answer, at a fraction of the work.
+struct ReplacementRule {
+    static constexpr bool SHORTEST = false;
+    static constexpr bool JUMPS = false;
+    uint64_t k;
+    bool exact;
+    uint64_t count[256] = {0};
+    vector<uint32_t> withCount;
+    uint64_t maxCount = 0;
+
+    explicit ReplacementRule(uint64_t allowed = 0, bool exactWindows = true)
+        : k(allowed), exact(exactWindows), withCount(64, 0) {
+        withCount[0] = 256;
+    }
+
+    void add(uint8_t c) {
+        uint64_t v = ++count[c];
+        if (v > maxCount) maxCount = v;
+        if (!exact) return;
+        if (v >= withCount.size()) withCount.resize(withCount.size() * 2, 0);
+        withCount[v - 1]--;
+        withCount[v]++;
+    }
+    void remove(uint8_t c) {
+        uint64_t v = count[c]--;
+        if (!exact) return;
+        withCount[v]--;
+        withCount[v - 1]++;
+        if (v == maxCount && withCount[v] == 0) maxCount--;
+    }
+    bool valid(uint64_t length) const { return length - maxCount <= k; }
+};
+
+// Usage: length = longestRepeatingReplacementStream(str, k)
+// Example: longestRepeatingReplacementStream("AABABBA", 1) returns 4
+uint64_t longestRepeatingReplacementStream(string_view str, uint64_t k) {
+    WindowStream<ReplacementRule> stream{ReplacementRule(k, false)};
+    BestWindow best;
+    stream.feed(str, [&](uint64_t s, uint64_t len) { best.offerLonger(s, len); });
+    return best.length;
+}
+
+// ========================================
+// 3. SHORTEST WINDOW CONTAINING A PATTERN'S BYTES
+// ========================================
+// Only the positions that can still start the shortest cover are kept:
+// for each pattern byte c, its last need[c] occurrences ("live" ones).
+// A window [s, e) covers the pattern iff s <= the oldest live occurrence
+// of every byte, so the shortest cover ending at e starts at the oldest
+// live occurrence overall. Live occurrences sit in a pool of one node per
+// pattern byte, linked in stream order; a new occurrence of c recycles
+// c's oldest node once c has need[c] of them. Memory is O(pattern),
+// whatever the stream holds between covers.
+// deficit = pattern bytes (with multiplicity) not yet live; a cover
+// exists when it is zero. A cover is reported only when the byte just
+// added moves its start (or completes the first one), i.e. when it ends
+// a window no shorter cover ending earlier lies inside.
+struct CoverRule {
+    static constexpr bool SHORTEST = true;
+    static constexpr bool JUMPS = true;
+    static constexpr size_t NONE = SIZE_MAX;
+    uint64_t need[256] = {0};
+    uint64_t live[256] = {0};
+    size_t base[256] = {0};    // c's nodes are base[c] .. base[c] + need[c] - 1
+    size_t oldest[256] = {0};  // ring offset of c's oldest live node
+    vector<uint64_t> pos;
+    vector<size_t> prev, next;
+    size_t head = NONE, tail = NONE;
+    uint64_t deficit = 0;
+    bool moved = false;
+
+    explicit CoverRule(string_view pattern = "")
+        : pos(pattern.size()), prev(pattern.size()), next(pattern.size()) {
+        for (unsigned char c : pattern) need[c]++;
+        size_t offset = 0;
+        for (int c = 0; c < 256; c++) {
+            base[c] = offset;
+            offset += need[c];
+        }
+        deficit = pattern.size();
+    }
+
+    uint64_t addAt(uint8_t c, uint64_t at, uint64_t start) {
+        moved = false;
+        if (need[c] == 0) return start;
+        size_t node;
+        if (live[c] == need[c]) {
+            node = base[c] + oldest[c];
+            oldest[c] = oldest[c] + 1 == need[c] ? 0 : oldest[c] + 1;
+            moved = deficit == 0 && node == head;
+            unlink(node);
+        } else {
+            node = base[c] + (oldest[c] + live[c]) % need[c];
+            live[c]++;
+            moved = --deficit == 0;
+        }
+        pos[node] = at;
+        prev[node] = tail;
+        next[node] = NONE;
+        (tail == NONE ? head : next[tail]) = node;
+        tail = node;
+        return deficit == 0 ? pos[head] : start;
+    }
+    bool valid(uint64_t) const { return moved; }
+
+private:
+    void unlink(size_t node) {
+        (prev[node] == NONE ? head : next[prev[node]]) = next[node];
+        (next[node] == NONE ? tail : prev[next[node]]) = prev[node];
+    }
+};
+
+// Usage: result = minWindowSubstringStream(str, pattern)
+// Example: minWindowSubstringStream("ADOBECODEBANC", "ABC") returns "BANC"
+string minWindowSubstringStream(string_view str, string_view pattern) {
+    if (str.empty() || pattern.empty()) return "";
+    WindowStream<CoverRule> stream{CoverRule(pattern)};
+    BestWindow best;
+    stream.feed(str, [&](uint64_t s, uint64_t len) { best.offerShorter(s, len); });
+    return best.found ? string(str.substr(best.start, best.length)) : "";
+}
+
+// ========================================
+// BASELINE (copies of advanced_problems.cpp)
+// ========================================
+
+int longestUniqueSubstring(string str) {
+    unordered_map<char, int> charIndex;
+    int maxLen = 0;
+    int start = 0;
+
+    for (int end = 0; end < (int)str.length(); end++) {
+        if (charIndex.find(str[end]) != charIndex.end()) {
+            start = max(start, charIndex[str[end]] + 1);
+        }
+        charIndex[str[end]] = end;
+        maxLen = max(maxLen, end - start + 1);
+    }
+
+    return maxLen;
+}
+
+string minWindowSubstring(string str, string pattern) {
+    if (str.empty() || pattern.empty()) return "";
+
+    unordered_map<char, int> patternCount, windowCount;
+    for (char ch : pattern) {
+        patternCount[ch]++;
+    }
+
+    int required = patternCount.size();
+    int formed = 0;
+    int left = 0, right = 0;
+    int minLen = INT_MAX, minLeft = 0;
+
+    while (right < (int)str.length()) {
+        char ch = str[right];
+        windowCount[ch]++;
+
+        if (patternCount.find(ch) != patternCount.end() &&
+            windowCount[ch] == patternCount[ch]) {
+            formed++;
+        }
+
+        while (left <= right && formed == required) {
+            if (right - left + 1 < minLen) {
+                minLen = right - left + 1;
+                minLeft = left;
+            }
+
+            char leftChar = str[left];
+            windowCount[leftChar]--;
+            if (patternCount.find(leftChar) != patternCount.end() &&
+                windowCount[leftChar] < patternCount[leftChar]) {
+                formed--;
+            }
+            left++;
+        }
+
+        right++;
+    }
+
+    return minLen == INT_MAX ? "" : str.substr(minLeft, minLen);
+}
+
+int longestRepeatingReplacement(string str, int k) {
+    unordered_map<char, int> count;
+    int maxCount = 0;
+    int maxLen = 0;
+    int start = 0;
+
+    for (int end = 0; end < (int)str.length(); end++) {
+        count[str[end]]++;
+        maxCount = max(maxCount, count[str[end]]);
+
+        while (end - start + 1 - maxCount > k) {
+            count[str[start]]--;
+            start++;
+        }
+
+        maxLen = max(maxLen, end - start + 1);
+    }
+
+    return maxLen;
+}
+
+// ========================================
+// BENCHMARK: MULTI-GB STREAMS
+// ========================================
+// Usage: benchmarkSlidingWindow(totalBytes)
+// Example: benchmarkSlidingWindow(1ULL << 32) - 4 GB streamed in 1 MB chunks
+void benchmarkSlidingWindow(uint64_t totalBytes) {
+    using Clock = chrono::steady_clock;
+    auto seconds = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // One 1 MB chunk of lowercase text, fed repeatedly; mostly 4 letters so
+    // replacement windows grow long
+    mt19937 rng(22);
+    const size_t CHUNK = 1 << 20;
+    string chunk(CHUNK, 'a');
+    for (char& c : chunk) c = rng() % 8 == 0 ? (char)('a' + rng() % 26) : (char)('a' + rng() % 4);
+    uint64_t chunks = max<uint64_t>(1, totalBytes / CHUNK);
+
+    // Baselines on a single in-memory string (the stream never is)
+    string text;
+    for (int i = 0; i < 64; i++) text += chunk;
+    cout << "stream " << chunks * CHUNK / (1 << 20) << " MB in 1 MB chunks; baseline on "
+         << text.size() / (1 << 20) << " MB string" << endl;
+    cout << "problem  original MB/s  stream MB/s  result" << endl;
+
+    auto runStream = [&](auto stream, auto&& offer, const char* name, double baseRate) {
+        BestWindow best;
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < chunks; i++) {
+            stream.feed(chunk, [&](uint64_t s, uint64_t len) { offer(best, s, len); });
+        }
+        double rate = chunks * CHUNK / seconds(start) / 1e6;
+        cout << name << "  " << baseRate << "  " << rate << "  " << best.length << endl;
+    };
+    auto baseline = [&](auto&& body) {
+        auto start = Clock::now();
+        long long result = body();
+        double rate = text.size() / seconds(start) / 1e6;
+        return make_pair(rate, result);
+    };
+
+    auto unique = baseline([&] { return (long long)longestUniqueSubstring(text); });
+    runStream(WindowStream<UniqueBytesRule>(), [](BestWindow& b, uint64_t s, uint64_t len) { b.offerLonger(s, len); },
+              "longestUnique", unique.first);
+
+    auto replace = baseline([&] { return (long long)longestRepeatingReplacement(text, 6); });
+    runStream(WindowStream<ReplacementRule>(ReplacementRule(6, false)),
+              [](BestWindow& b, uint64_t s, uint64_t len) { b.offerLonger(s, len); },
+              "repeatingReplacement k=6", replace.first);
+    runStream(WindowStream<ReplacementRule>(ReplacementRule(6, true)),
+              [](BestWindow& b, uint64_t s, uint64_t len) { b.offerLonger(s, len); },
+              "repeatingReplacement k=6 (exact windows)", replace.first);
+
+    auto cover = baseline([&] { return (long long)minWindowSubstring(text, "xyzzy").size(); });
+    runStream(WindowStream<CoverRule>(CoverRule("xyzzy")),
+              [](BestWindow& b, uint64_t s, uint64_t len) { b.offerShorter(s, len); },
+              "minWindow \"xyzzy\"", cover.first);
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Streaming Sliding Windows ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Longest substring without repeating characters
+    // cout << "Longest unique substring length: " << longestUniqueSubstringStream(str) << endl;
+
+    // 2. Longest repeating character replacement
+    // cout << "Longest repeating replacement length: " << longestRepeatingReplacementStream(str, 2) << endl;
+
+    // 3. Minimum window substring
+    // cout << "Minimum window: " << minWindowSubstringStream(str, "ABC") << endl;
+
+    // Input in chunks: every window is reported with stream offsets
+    // WindowStream<CoverRule> stream{CoverRule("ab")};
+    // auto report = [](uint64_t start, uint64_t length) { cout << "[" << start << ", +" << length << ") "; };
+    // stream.feed(str.substr(0, str.size() / 2), report);
+    // stream.feed(str.substr(str.size() / 2), report);
+    // cout << endl;
+
+    // Throughput on a multi-GB stream
+    // benchmarkSlidingWindow(1ULL << 32);
+
+    return 0;
+}
@@ -0,0 +1,516 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#if defined(__x86_64__) || defined(__i386__)
+#define SEARCH_X86 1
+#include <immintrin.h>
+#else
+#define SEARCH_X86 0
+#endif
+using namespace std;
+
+// ========================================
+// SIMD SUBSTRING SEARCH
+// ========================================
+// Concept: findSubstring / countSubstring (core_problems.cpp) and
+// rabinKarp (advanced_problems.cpp) search for one needle. This module
+// does the same job with a vectorized candidate filter:
+// - Compare 16 (SSE2) or 32 (AVX2) haystack positions at once against
+//   the needle's first byte, and the bytes m-1 further on against its
+//   last byte; only positions where both match are checked with memcmp.
+//   On ordinary text almost every block has no candidate at all
+// - Some inputs make nearly every position a candidate (e.g. needle
+//   "aaa...aba" in "aaaa..."). The scan counts verification work and,
+//   once it costs more than a few times the bytes scanned, switches to
+//   Two-Way (Crochemore-Perrin), which is linear time and O(1) space
+// - count() gives the number of occurrences in one pass, overlapping or
+//   not (countSubstring counts non-overlapping ones)
+// The instruction set is picked at runtime; setSimdLevel caps it.
+
+enum class SimdLevel { SCALAR = 0, SSE2 = 1, AVX2 = 2 };
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+SimdLevel detectSimdLevel() {
+#if SEARCH_X86 && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+SimdLevel simdLevelCap = SimdLevel::AVX2;
+
+// Usage: setSimdLevel(SimdLevel::SSE2) - never use anything above SSE2
+void setSimdLevel(SimdLevel level) {
+    simdLevelCap = level;
+}
+
+SimdLevel currentSimdLevel() {
+    static const SimdLevel detected = detectSimdLevel();
+    return min(detected, simdLevelCap);
+}
+
+const size_t NO_MATCH = string::npos;
+
+// ========================================
+// 1. TWO-WAY (CROCHEMORE-PERRIN)
+// ========================================
+// Concept: Split the needle at a critical factorization x = u v. Match v
+// left to right, then u right to left; on a mismatch the shift is
+// derived from the needle's period, so no haystack byte is compared more
+// than twice. Used for the tail of the haystack and as the fallback.
+struct TwoWay {
+    const unsigned char* x = nullptr;
+    ptrdiff_t m = 0;
+    ptrdiff_t ell = -1;     // u = x[0..ell], v = x[ell+1..m-1]
+    ptrdiff_t per = 1;      // period of x (periodic case) or a safe shift
+    bool periodic = false;
+
+    // Start of the maximal suffix of x and its period, for the ordering
+    // "<" (reversed = false) or ">" (reversed = true)
+    static ptrdiff_t maxSuffix(const unsigned char* x, ptrdiff_t m, ptrdiff_t& p, bool reversed) {
+        ptrdiff_t ms = -1, j = 0, k = 1;
+        p = 1;
+        while (j + k < m) {
+            unsigned char a = x[j + k], b = x[ms + k];
+            if (reversed ? a > b : a < b) {
+                j += k;
+                k = 1;
+                p = j - ms;
+            } else if (a == b) {
+                if (k != p) {
+                    k++;
+                } else {
+                    j += p;
+                    k = 1;
+                }
+            } else {
+                ms = j;
+                j = ms + 1;
+                k = p = 1;
+            }
+        }
+        return ms;
+    }
+
+    void init(string_view needle) {
+        x = (const unsigned char*)needle.data();
+        m = (ptrdiff_t)needle.size();
+        ptrdiff_t p, q;
+        ptrdiff_t i = maxSuffix(x, m, p, false);
+        ptrdiff_t j = maxSuffix(x, m, q, true);
+        if (i > j) {
+            ell = i;
+            per = p;
+        } else {
+            ell = j;
+            per = q;
+        }
+        periodic = ell + 1 + per <= m && memcmp(x, x + per, ell + 1) == 0;
+        if (!periodic) per = max(ell + 1, m - ell - 1) + 1;
+    }
+
+    // Calls next(pos) for each match at or after `from`; next returns the
+    // position to resume from (> pos), or NO_MATCH to stop.
+    template <typename Next>
+    void scan(const unsigned char* y, size_t n, size_t from, Next& next) const {
+        ptrdiff_t j = (ptrdiff_t)from, last = (ptrdiff_t)n - m;
+        ptrdiff_t memory = -1;
+        while (j <= last) {
+            ptrdiff_t i = max(ell, memory) + 1;
+            while (i < m && x[i] == y[i + j]) i++;
+            if (i < m) {
+                j += i - ell;
+                memory = -1;
+                continue;
+            }
+            i = ell;
+            while (i > memory && x[i] == y[i + j]) i--;
+            if (i <= memory) {
+                size_t resume = next((size_t)j);
+                if (resume == NO_MATCH) return;
+                // Overlapping resume at j + per keeps the matched prefix
+                memory = periodic && (ptrdiff_t)resume == j + per ? m - per - 1 : -1;
+                j = (ptrdiff_t)resume;
+            } else {
+                j += per;
+                memory = periodic ? m - per - 1 : -1;
+            }
+        }
+    }
+};
+
+// Verification work allowed before switching to Two-Way:
+// candidates * m may exceed the scanned bytes by this factor plus slack
+const size_t FALLBACK_FACTOR = 8;
+const size_t FALLBACK_SLACK = 4096;
+
+// ========================================
+// SCALAR KERNEL (memchr first byte, then last byte)
+// ========================================
+namespace scalar {
+
+template <typename Next>
+void scanFirstLast(const char* h, size_t n, const char* x, size_t m, size_t i, const TwoWay& tw, Next& next) {
+    size_t start = i, candidates = 0;
+    while (i + m <= n) {
+        const char* p = (const char*)memchr(h + i, x[0], n - m + 1 - i);
+        if (!p) return;
+        size_t pos = p - h;
+        candidates++;
+        i = pos + 1;
+        if (h[pos + m - 1] == x[m - 1] && memcmp(h + pos + 1, x + 1, m > 2 ? m - 2 : 0) == 0) {
+            i = next(pos);
+            if (i == NO_MATCH) return;
+        }
+        if (candidates * m > FALLBACK_FACTOR * (i - start) + FALLBACK_SLACK) break;
+    }
+    tw.scan((const unsigned char*)h, n, i, next);
+}
+
+}  // namespace scalar
+
+#if SEARCH_X86
+
+// First/last-byte filter shared by every instruction set. ByteOps
+// provides V, WIDTH, load, set1, eq, vand and mask (one bit per byte).
+#define DEFINE_SEARCH_KERNELS                                                   \
+template <typename Ops, typename Next>                                          \
+void scanFirstLast(const char* h, size_t n, const char* x, size_t m, size_t i,  \
+                   const TwoWay& tw, Next& next) {                              \
+    const size_t W = Ops::WIDTH;                                                \
+    const typename Ops::V first = Ops::set1(x[0]), last = Ops::set1(x[m - 1]);  \
+    size_t start = i, candidates = 0;                                           \
+    while (i + m - 1 + W <= n) {                                                \
+        uint32_t mask = Ops::mask(Ops::vand(Ops::eq(first, Ops::load(h + i)),   \
+                                            Ops::eq(last, Ops::load(h + i + m - 1)))); \
+        size_t resume = i + W;                                                  \
+        while (mask) {                                                          \
+            size_t pos = i + __builtin_ctz(mask);                               \
+            mask &= mask - 1;                                                   \
+            candidates++;                                                       \
+            if (m > 2 && memcmp(h + pos + 1, x + 1, m - 2) != 0) continue;      \
+            size_t after = next(pos);                                           \
+            if (after == NO_MATCH) return;                                      \
+            if (after - i >= W) {                                               \
+                resume = after;                                                 \
+                break;                                                          \
+            }                                                                   \
+            mask &= ~0u << (after - i);                                         \
+        }                                                                       \
+        i = resume;                                                             \
+        if (candidates * m > FALLBACK_FACTOR * (i - start) + FALLBACK_SLACK) break; \
+    }                                                                           \
+    /* Tail shorter than a block, or pathological input */                     \
+    tw.scan((const unsigned char*)h, n, i, next);                               \
+}
+
+// ========================================
+// SSE2 KERNEL
+// ========================================
+namespace sse2 {
+
+struct ByteOps {
+    typedef __m128i V;
+    static const size_t WIDTH = 16;
+    static V load(const char* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static V set1(char c) { return _mm_set1_epi8(c); }
+    static V eq(V a, V b) { return _mm_cmpeq_epi8(a, b); }
+    static V vand(V a, V b) { return _mm_and_si128(a, b); }
+    static uint32_t mask(V v) { return (uint32_t)_mm_movemask_epi8(v); }
+};
+
+DEFINE_SEARCH_KERNELS
+
+}  // namespace sse2
+
+// ========================================
+// AVX2 KERNEL
+// ========================================
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+
+struct ByteOps {
+    typedef __m256i V;
+    static const size_t WIDTH = 32;
+    static V load(const char* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static V set1(char c) { return _mm256_set1_epi8(c); }
+    static V eq(V a, V b) { return _mm256_cmpeq_epi8(a, b); }
+    static V vand(V a, V b) { return _mm256_and_si256(a, b); }
+    static uint32_t mask(V v) { return (uint32_t)_mm256_movemask_epi8(v); }
+};
+
+DEFINE_SEARCH_KERNELS
+
+}  // namespace avx2
+#pragma GCC pop_options
+
+#endif  // SEARCH_X86
+
+// ========================================
+// 2. SEARCHER (PUBLIC API)
+// ========================================
+// Usage: SubstringSearcher s("needle"); s.find(hay); s.count(hay);
+//        s.forEach(hay, [](size_t pos) { ... });  - all, overlapping
+// Example: SubstringSearcher("aba").count("ababa") returns 1,
+//          count("ababa", true) returns 2
+// The searcher keeps a view of the needle; the needle must outlive it.
+class SubstringSearcher {
+public:
+    explicit SubstringSearcher(string_view needle) : pattern(needle) {
+        if (!pattern.empty()) tw.init(pattern);
+    }
+
+    // First occurrence at or after `from`, or NO_MATCH
+    size_t find(string_view hay, size_t from = 0) const {
+        if (pattern.empty()) return from <= hay.size() ? from : NO_MATCH;
+        size_t found = NO_MATCH;
+        auto stop = [&](size_t pos) {
+            found = pos;
+            return NO_MATCH;
+        };
+        scan(hay, from, stop);
+        return found;
+    }
+
+    // Number of occurrences; non-overlapping by default like countSubstring
+    size_t count(string_view hay, bool overlapping = false) const {
+        if (pattern.empty()) return 0;
+        size_t total = 0, step = overlapping ? 1 : pattern.size();
+        auto next = [&](size_t pos) {
+            total++;
+            return pos + step;
+        };
+        scan(hay, 0, next);
+        return total;
+    }
+
+    // Every (overlapping) match position, in increasing order
+    template <typename Callback>
+    void forEach(string_view hay, Callback&& onMatch) const {
+        if (pattern.empty()) return;
+        auto next = [&](size_t pos) {
+            onMatch(pos);
+            return pos + 1;
+        };
+        scan(hay, 0, next);
+    }
+
+private:
+    string_view pattern;
+    TwoWay tw;
+
+    template <typename Next>
+    void scan(string_view hay, size_t from, Next& next) const {
+        const char* h = hay.data();
+        size_t n = hay.size(), m = pattern.size();
+        if (m > n || from > n - m) return;
+        const char* x = pattern.data();
+#if SEARCH_X86
+        switch (currentSimdLevel()) {
+            case SimdLevel::AVX2: avx2::scanFirstLast<avx2::ByteOps>(h, n, x, m, from, tw, next); return;
+            case SimdLevel::SSE2: sse2::scanFirstLast<sse2::ByteOps>(h, n, x, m, from, tw, next); return;
+            default: break;
+        }
+#endif
+        scalar::scanFirstLast(h, n, x, m, from, tw, next);
+    }
+};
+
+// Drop-in versions of findSubstring / countSubstring
+// Usage: index = findSubstringFast(str, substr) - NO_MATCH if absent
+// Example: findSubstringFast("hello world", "world") returns 6
+size_t findSubstringFast(string_view str, string_view substr) {
+    return SubstringSearcher(substr).find(str);
+}
+
+// Example: countSubstringFast("ababab", "ab") returns 3
+size_t countSubstringFast(string_view str, string_view substr) {
+    return SubstringSearcher(substr).count(str);
+}
+
+// ========================================
+// BASELINE (copies of core_problems.cpp / advanced_problems.cpp, without printing)
+// ========================================
+
+int countSubstring(string str, string substr) {
+    int count = 0;
+    size_t pos = 0;
+
+    while ((pos = str.find(substr, pos)) != string::npos) {
+        count++;
+        pos += substr.length();
+    }
+    return count;
+}
+
+vector<int> rabinKarp(string text, string pattern) {
+    vector<int> found;
+    int d = 256;
+    int q = 101;
+    int m = pattern.length();
+    int n = text.length();
+    int p = 0;
+    int t = 0;
+    int h = 1;
+    if (m == 0 || m > n) return found;
+
+    for (int i = 0; i < m - 1; i++) {
+        h = (h * d) % q;
+    }
+    for (int i = 0; i < m; i++) {
+        p = (d * p + pattern[i]) % q;
+        t = (d * t + text[i]) % q;
+    }
+    for (int i = 0; i <= n - m; i++) {
+        if (p == t) {
+            bool match = true;
+            for (int j = 0; j < m; j++) {
+                if (text[i + j] != pattern[j]) {
+                    match = false;
+                    break;
+                }
+            }
+            if (match) {
+                found.push_back(i);
+            }
+        }
+        if (i < n - m) {
+            t = (d * (t - text[i] * h) + text[i + m]) % q;
+            if (t < 0) {
+                t = (t + q);
+            }
+        }
+    }
+    return found;
+}
+
+// Same counting loop as countSubstring, using std::boyer_moore_horspool_searcher
+int countSubstringHorspool(const string& str, const string& substr) {
+    boyer_moore_horspool_searcher<string::const_iterator> searcher(substr.begin(), substr.end());
+    int count = 0;
+    auto it = str.begin();
+    while (true) {
+        it = search(it, str.end(), searcher);
+        if (it == str.end()) break;
+        count++;
+        it += substr.length();
+    }
+    return count;
+}
+
+// ========================================
+// BENCHMARK
+// ========================================
+// Usage: benchmarkSubstringSearch(bytes)
+// Example: benchmarkSubstringSearch(1 << 24) - count all occurrences in 16 MB
+void benchmarkSubstringSearch(size_t bytes) {
+    using Clock = chrono::steady_clock;
+    auto gbps = [&](auto&& body) {
+        auto start = Clock::now();
+        body();
+        return bytes / chrono::duration<double>(Clock::now() - start).count() / 1e9;
+    };
+
+    // Word-like text; each needle is cut from the text so it does occur
+    mt19937 rng(19);
+    const char* words[] = {"the", "request", "server", "latency", "status", "error", "of", "and",
+                           "connection", "timeout", "user", "session", "a", "to", "in", "data"};
+    string text;
+    text.reserve(bytes + 16);
+    while (text.size() < bytes) {
+        text += words[rng() % 16];
+        text += ' ';
+    }
+    text.resize(bytes);
+    size_t sink = 0;
+
+    cout << "Detected SIMD level: " << simdLevelName(detectSimdLevel()) << endl;
+    cout << "needle  find  horspool  rabinKarp  scalar  sse2  avx2 (GB/s)" << endl;
+    auto runRow = [&](const string& hay, const string& needle, const string& label) {
+        int expected = countSubstring(hay, needle);
+        cout << label << "  ";
+        cout << gbps([&] { sink += countSubstring(hay, needle); }) << "  ";
+        cout << gbps([&] { sink += countSubstringHorspool(hay, needle); }) << "  ";
+        cout << gbps([&] { sink += rabinKarp(hay, needle).size(); }) << "  ";
+        for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+            setSimdLevel(level);
+            size_t got = 0;
+            cout << gbps([&] { got = countSubstringFast(hay, needle); }) << "  ";
+            if ((int)got != expected) cout << "MISMATCH ";
+        }
+        setSimdLevel(SimdLevel::AVX2);
+        cout << endl;
+    };
+
+    for (size_t m : {4, 8, 16, 32, 64}) {
+        string needle = text.substr(bytes - 4096 + rng() % 1024, m);
+        runRow(text, needle, "m=" + to_string(m));
+    }
+
+    // Pathological: every position passes the first/last filter
+    string flat(bytes, 'a');
+    string needle = string(31, 'a') + "b" + string(32, 'a');
+    runRow(flat, needle, "a..ba..a");
+    cout << "(checksum " << sink << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== SIMD Substring Search ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1. Find
+    // size_t pos = findSubstringFast(str, "world");
+    // if (pos != NO_MATCH) {
+    //     cout << "Substring found at index: " << pos << endl;
+    // } else {
+    //     cout << "Substring not found." << endl;
+    // }
+
+    // 2. Count (non-overlapping, like countSubstring)
+    // cout << "Substring occurrences: " << countSubstringFast(str, "ab") << endl;
+
+    // 3. Reuse one searcher; list every overlapping match
+    // SubstringSearcher searcher("aba");
+    // cout << "Overlapping occurrences: " << searcher.count(str, true) << endl;
+    // searcher.forEach(str, [](size_t p) { cout << p << " "; });
+    // cout << endl;
+
+    // Force a code path
+    // setSimdLevel(SimdLevel::SSE2);
+
+    // Throughput vs std::string::find, Horspool and rabinKarp
+    // benchmarkSubstringSearch(1 << 24);
+
+    return 0;
+}
@@ -0,0 +1,666 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#if defined(__unix__) || defined(__APPLE__)
+#define INDEX_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define INDEX_MMAP 0
+#endif
+using namespace std;
+
+// ========================================
+// SUFFIX ARRAY INDEX
+// ========================================
+// Concept: findSubstring scans the whole text for every query. For a
+// fixed corpus queried many times, sort all suffixes once:
+// - Suffix array (SA-IS, linear time): sa[r] = start of the r-th
+//   smallest suffix. All occurrences of a pattern are the suffixes that
+//   start with it, which form one contiguous range of sa, found with two
+//   binary searches in O(m log n)
+// - LCP array (Kasai): lcp[r] = common prefix length of the suffixes at
+//   ranks r-1 and r. The longest repeated substring is the largest entry
+// - The index (text, sa, lcp) is written as one flat file and opened
+//   with mmap, so loading costs no parsing or copying; pages are read on
+//   first use
+// Manacher's algorithm replaces expand-around-center for
+// longestPalindrome (O(n) instead of O(n^2) worst case).
+// Positions are int32: texts must be shorter than 2^31 - 1 bytes.
+
+// ========================================
+// 1. SA-IS
+// ========================================
+// Concept: Classify suffixes as S (smaller than the next suffix) or L.
+// Sorting the LMS suffixes (S with an L to the left) is enough: the rest
+// are induced from them with two bucket passes. The LMS substrings are
+// named and, if names repeat, sorted by recursing on the shorter string
+// of names.
+// s has length n over [0, K) and ends with a unique 0 (sentinel).
+void saisBuild(const int32_t* s, int32_t* sa, int32_t n, int32_t K) {
+    if (n == 1) {
+        sa[0] = 0;
+        return;
+    }
+    vector<uint8_t> isS(n);
+    isS[n - 1] = 1;
+    for (int32_t i = n - 2; i >= 0; i--) {
+        isS[i] = s[i] < s[i + 1] || (s[i] == s[i + 1] && isS[i + 1]);
+    }
+    auto isLMS = [&](int32_t i) { return i > 0 && isS[i] && !isS[i - 1]; };
+
+    vector<int32_t> bucket(K);
+    auto bucketBounds = [&](bool ends) {
+        fill(bucket.begin(), bucket.end(), 0);
+        for (int32_t i = 0; i < n; i++) bucket[s[i]]++;
+        int32_t sum = 0;
+        for (int32_t c = 0; c < K; c++) {
+            int32_t count = bucket[c];
+            sum += count;
+            bucket[c] = ends ? sum : sum - count;
+        }
+    };
+    auto induce = [&]() {
+        bucketBounds(false);
+        for (int32_t i = 0; i < n; i++) {
+            int32_t j = sa[i] - 1;
+            if (sa[i] > 0 && !isS[j]) sa[bucket[s[j]]++] = j;
+        }
+        bucketBounds(true);
+        for (int32_t i = n - 1; i >= 0; i--) {
+            int32_t j = sa[i] - 1;
+            if (sa[i] > 0 && isS[j]) sa[--bucket[s[j]]] = j;
+        }
+    };
+
+    // Sort LMS substrings: drop them at bucket ends and induce
+    fill(sa, sa + n, -1);
+    bucketBounds(true);
+    for (int32_t i = 1; i < n; i++) {
+        if (isLMS(i)) sa[--bucket[s[i]]] = i;
+    }
+    induce();
+
+    // Compact the sorted LMS positions and name equal LMS substrings alike
+    int32_t n1 = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (isLMS(sa[i])) sa[n1++] = sa[i];
+    }
+    fill(sa + n1, sa + n, -1);
+    int32_t names = 0, prev = -1;
+    for (int32_t i = 0; i < n1; i++) {
+        int32_t pos = sa[i];
+        bool differs = false;
+        for (int32_t d = 0; d < n; d++) {
+            if (prev == -1 || s[pos + d] != s[prev + d] || isS[pos + d] != isS[prev + d]) {
+                differs = true;
+                break;
+            }
+            if (d > 0 && (isLMS(pos + d) || isLMS(prev + d))) break;
+        }
+        if (differs) {
+            names++;
+            prev = pos;
+        }
+        sa[n1 + pos / 2] = names - 1;  // LMS positions are at least 2 apart
+    }
+    for (int32_t i = n - 1, j = n - 1; i >= n1; i--) {
+        if (sa[i] >= 0) sa[j--] = sa[i];
+    }
+
+    // Order of the LMS suffixes: directly if names are unique, else recurse
+    int32_t* s1 = sa + n - n1;
+    int32_t* sa1 = sa;
+    if (names < n1) {
+        saisBuild(s1, sa1, n1, names);
+    } else {
+        for (int32_t i = 0; i < n1; i++) sa1[s1[i]] = i;
+    }
+
+    // Place the sorted LMS suffixes at their bucket ends and induce the rest
+    for (int32_t i = 1, j = 0; i < n; i++) {
+        if (isLMS(i)) s1[j++] = i;
+    }
+    for (int32_t i = 0; i < n1; i++) sa1[i] = s1[sa1[i]];
+    fill(sa + n1, sa + n, -1);
+    bucketBounds(true);
+    for (int32_t i = n1 - 1; i >= 0; i--) {
+        int32_t j = sa[i];
+        sa[i] = -1;
+        sa[--bucket[s[j]]] = j;
+    }
+    induce();
+}
+
+// Suffix array of the bytes of text (without the sentinel)
+vector<int32_t> buildSuffixArray(string_view text) {
+    int32_t n = (int32_t)text.size();
+    vector<int32_t> s(n + 1), sa(n + 1);
+    for (int32_t i = 0; i < n; i++) s[i] = (unsigned char)text[i] + 1;
+    s[n] = 0;
+    saisBuild(s.data(), sa.data(), n + 1, 257);
+    return vector<int32_t>(sa.begin() + 1, sa.end());  // sa[0] is the sentinel
+}
+
+// ========================================
+// 2. LCP (KASAI)
+// ========================================
+// Concept: Walking suffixes in text order, the common prefix with the
+// previous-ranked suffix drops by at most one per step, so all n values
+// take O(n) character comparisons.
+// lcp[0] = 0; lcp[r] = LCP(suffix sa[r-1], suffix sa[r])
+vector<int32_t> buildLcpArray(string_view text, const vector<int32_t>& sa) {
+    int32_t n = (int32_t)text.size();
+    vector<int32_t> rank(n), lcp(n, 0);
+    for (int32_t r = 0; r < n; r++) rank[sa[r]] = r;
+    int32_t h = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (rank[i] == 0) {
+            h = 0;
+            continue;
+        }
+        int32_t j = sa[rank[i] - 1];
+        while (i + h < n && j + h < n && text[i + h] == text[j + h]) h++;
+        lcp[rank[i]] = h;
+        if (h > 0) h--;
+    }
+    return lcp;
+}
+
+// ========================================
+// 3. INDEX (BUILD / QUERY / SAVE / OPEN)
+// ========================================
+// File layout (native byte order), every section 8-byte aligned:
+//   IndexHeader | text bytes | sa int32[n] | lcp int32[n]
+struct IndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t textLength;
+    uint64_t textOffset;
+    uint64_t saOffset;
+    uint64_t lcpOffset;
+    uint64_t fileSize;
+};
+
+const char INDEX_MAGIC[8] = {'S', 'U', 'F', 'I', 'D', 'X', '\0', '\0'};
+const uint32_t INDEX_VERSION = 1;
+
+// Usage: SuffixIndex idx(text); idx.count("ab"); idx.locate("ab");
+//        idx.save("corpus.idx"); SuffixIndex loaded; loaded.open("corpus.idx");
+// Example: SuffixIndex("banana").count("ana") returns 2
+class SuffixIndex {
+public:
+    SuffixIndex() = default;
+
+    explicit SuffixIndex(string_view corpus)
+        : ownedText(corpus), ownedSa(buildSuffixArray(corpus)), ownedLcp(buildLcpArray(corpus, ownedSa)) {
+        pointAtOwned();
+    }
+
+    SuffixIndex(const SuffixIndex&) = delete;
+    SuffixIndex& operator=(const SuffixIndex&) = delete;
+    SuffixIndex(SuffixIndex&& other) noexcept { *this = move(other); }
+    SuffixIndex& operator=(SuffixIndex&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            ownedText = move(other.ownedText);
+            ownedSa = move(other.ownedSa);
+            ownedLcp = move(other.ownedLcp);
+            mapBase = other.mapBase;
+            mapSize = other.mapSize;
+            other.mapBase = nullptr;
+            other.mapSize = 0;
+            if (mapBase) {
+                text = other.text;
+                sa = other.sa;
+                lcp = other.lcp;
+                n = other.n;
+            } else {
+                pointAtOwned();
+            }
+            other.pointAtOwned();
+        }
+        return *this;
+    }
+    ~SuffixIndex() { unmap(); }
+
+    size_t size() const { return n; }
+    string_view corpus() const { return string_view(text, n); }
+    bool isMapped() const { return mapBase != nullptr; }
+
+    // Rank range [first, second) of suffixes starting with pattern
+    pair<size_t, size_t> range(string_view pattern) const {
+        size_t m = pattern.size();
+        auto prefixCompare = [&](int32_t pos) {
+            return string_view(text + pos, min(m, n - (size_t)pos)).compare(pattern);
+        };
+        size_t lo = 0, hi = n;
+        while (lo < hi) {  // first suffix >= pattern
+            size_t mid = (lo + hi) / 2;
+            if (prefixCompare(sa[mid]) < 0) lo = mid + 1;
+            else hi = mid;
+        }
+        size_t first = lo;
+        hi = n;
+        while (lo < hi) {  // first suffix not starting with pattern
+            size_t mid = (lo + hi) / 2;
+            if (prefixCompare(sa[mid]) == 0) lo = mid + 1;
+            else hi = mid;
+        }
+        return {first, lo};
+    }
+
+    // Overlapping occurrences of pattern
+    size_t count(string_view pattern) const {
+        if (pattern.empty()) return 0;
+        auto r = range(pattern);
+        return r.second - r.first;
+    }
+
+    // Start positions of every occurrence, in increasing order
+    vector<size_t> locate(string_view pattern) const {
+        vector<size_t> positions;
+        if (pattern.empty()) return positions;
+        auto r = range(pattern);
+        for (size_t i = r.first; i < r.second; i++) positions.push_back((size_t)sa[i]);
+        sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    // First occurrence, or string::npos (same contract as string::find)
+    size_t findFirst(string_view pattern) const {
+        if (pattern.empty()) return 0;
+        auto r = range(pattern);
+        if (r.first == r.second) return string::npos;
+        return (size_t)*min_element(sa + r.first, sa + r.second);
+    }
+
+    // Longest substring that occurs at least twice (possibly overlapping)
+    string_view longestRepeated() const {
+        size_t best = 0, at = 0;
+        for (size_t r = 1; r < n; r++) {
+            if ((size_t)lcp[r] > best) {
+                best = lcp[r];
+                at = sa[r];
+            }
+        }
+        return string_view(text + at, best);
+    }
+
+    // One flat file; returns false on any I/O error
+    bool save(const string& path) const {
+        IndexHeader h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, INDEX_MAGIC, sizeof(h.magic));
+        h.version = INDEX_VERSION;
+        h.textLength = n;
+        h.textOffset = sizeof(IndexHeader);
+        h.saOffset = alignUp(h.textOffset + n);
+        h.lcpOffset = h.saOffset + n * sizeof(int32_t);
+        h.fileSize = h.lcpOffset + n * sizeof(int32_t);
+
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f) return false;
+        static const char zeros[8] = {0};
+        bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+                  fwrite(text, 1, n, f) == n &&
+                  fwrite(zeros, 1, h.saOffset - h.textOffset - n, f) == h.saOffset - h.textOffset - n &&
+                  fwrite(sa, sizeof(int32_t), n, f) == n &&
+                  fwrite(lcp, sizeof(int32_t), n, f) == n;
+        return fclose(f) == 0 && ok;
+    }
+
+    // Maps a file written by save() (read into memory where mmap is not
+    // available). Returns false if it is missing, truncated or not an index.
+    bool open(const string& path) {
+        unmap();
+        ownedText.clear();
+        ownedSa.clear();
+        ownedLcp.clear();
+        pointAtOwned();
+#if INDEX_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(IndexHeader)) {
+            close(fd);
+            return false;
+        }
+        void* base = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) return false;
+        const IndexHeader* h = (const IndexHeader*)base;
+        if (!headerValid(*h, st.st_size)) {
+            munmap(base, st.st_size);
+            return false;
+        }
+        mapBase = base;
+        mapSize = st.st_size;
+        text = (const char*)base + h->textOffset;
+        sa = (const int32_t*)((const char*)base + h->saOffset);
+        lcp = (const int32_t*)((const char*)base + h->lcpOffset);
+        n = h->textLength;
+        return true;
+#else
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) return false;
+        IndexHeader h;
+        bool ok = fread(&h, sizeof(h), 1, f) == 1 && fseek(f, 0, SEEK_END) == 0;
+        long fileSize = ok ? ftell(f) : -1;
+        ok = ok && fileSize >= 0 && headerValid(h, (uint64_t)fileSize);
+        if (ok) {
+            ownedText.resize(h.textLength);
+            ownedSa.resize(h.textLength);
+            ownedLcp.resize(h.textLength);
+            ok = fseek(f, (long)h.textOffset, SEEK_SET) == 0 &&
+                 fread(&ownedText[0], 1, h.textLength, f) == h.textLength &&
+                 fseek(f, (long)h.saOffset, SEEK_SET) == 0 &&
+                 fread(ownedSa.data(), sizeof(int32_t), h.textLength, f) == h.textLength &&
+                 fread(ownedLcp.data(), sizeof(int32_t), h.textLength, f) == h.textLength;
+        }
+        fclose(f);
+        if (!ok) {
+            ownedText.clear();
+            ownedSa.clear();
+            ownedLcp.clear();
+        }
+        pointAtOwned();
+        return ok;
+#endif
+    }
+
+private:
+    string ownedText;
+    vector<int32_t> ownedSa, ownedLcp;
+    const char* text = "";
+    const int32_t* sa = nullptr;
+    const int32_t* lcp = nullptr;
+    size_t n = 0;
+    void* mapBase = nullptr;
+    size_t mapSize = 0;
+
+    static uint64_t alignUp(uint64_t x) { return (x + 7) & ~(uint64_t)7; }
+
+    static bool headerValid(const IndexHeader& h, uint64_t fileSize) {
+        if (memcmp(h.magic, INDEX_MAGIC, sizeof(h.magic)) != 0 || h.version != INDEX_VERSION) return false;
+        uint64_t len = h.textLength;
+        return len < (1ULL << 31) && h.fileSize == fileSize && h.textOffset == sizeof(IndexHeader) &&
+               h.saOffset == alignUp(h.textOffset + len) && h.lcpOffset == h.saOffset + len * 4 &&
+               h.fileSize == h.lcpOffset + len * 4;
+    }
+
+    void pointAtOwned() {
+        text = ownedText.data();
+        sa = ownedSa.data();
+        lcp = ownedLcp.data();
+        n = ownedText.size();
+    }
+
+    void unmap() {
+#if INDEX_MMAP
+        if (mapBase) munmap(mapBase, mapSize);
+#endif
+        mapBase = nullptr;
+        mapSize = 0;
+    }
+};
+
+// ========================================
+// 4. LONGEST COMMON SUBSTRING
+// ========================================
+// Concept: Suffix array of a + separator + b. The answer is the largest
+// LCP between neighbouring suffixes that come from different strings;
+// the separator (a symbol that is not a byte) stops prefixes crossing.
+// Usage: common = longestCommonSubstring(str1, str2)
+// Example: longestCommonSubstring("xabcdy", "zbcdw") returns "bcd"
+string longestCommonSubstring(string_view a, string_view b) {
+    int32_t na = (int32_t)a.size(), n = (int32_t)(a.size() + b.size() + 1);
+    vector<int32_t> s(n + 1), sa(n + 1);
+    for (int32_t i = 0; i < na; i++) s[i] = (unsigned char)a[i] + 2;
+    s[na] = 1;
+    for (int32_t i = 0; i < (int32_t)b.size(); i++) s[na + 1 + i] = (unsigned char)b[i] + 2;
+    s[n] = 0;
+    saisBuild(s.data(), sa.data(), n + 1, 258);
+
+    // Kasai over the integer string (the separator never matches)
+    vector<int32_t> rank(n + 1);
+    for (int32_t r = 0; r <= n; r++) rank[sa[r]] = r;
+    int32_t best = 0, bestAt = 0, h = 0;
+    for (int32_t i = 0; i < n; i++) {
+        int32_t j = sa[rank[i] - 1];  // rank[i] >= 1: the sentinel has rank 0
+        while (s[i + h] == s[j + h] && s[i + h] > 1) h++;
+        if (h > best && (i < na) != (j < na)) {
+            best = h;
+            bestAt = i;
+        }
+        if (h > 0) h--;
+    }
+    if (best == 0) return "";
+    return bestAt < na ? string(a.substr(bestAt, best)) : string(b.substr(bestAt - na - 1, best));
+}
+
+// ========================================
+// 5. LONGEST PALINDROME (MANACHER)
+// ========================================
+// Concept: Radii of odd (d1) and even (d2) palindromes around each
+// center. Inside the rightmost palindrome found so far, a center's
+// radius starts from its mirror's, so the total expansion is O(n).
+// Returns the leftmost longest palindrome, like longestPalindrome.
+// Usage: result = longestPalindromeManacher(str)
+// Example: longestPalindromeManacher("babad") returns "bab"
+string longestPalindromeManacher(string_view str) {
+    int n = (int)str.size();
+    if (n == 0) return "";
+    vector<int> d1(n), d2(n);
+    for (int i = 0, l = 0, r = -1; i < n; i++) {
+        int k = i > r ? 1 : min(d1[l + r - i], r - i + 1);
+        while (i - k >= 0 && i + k < n && str[i - k] == str[i + k]) k++;
+        d1[i] = k--;
+        if (i + k > r) {
+            l = i - k;
+            r = i + k;
+        }
+    }
+    for (int i = 0, l = 0, r = -1; i < n; i++) {
+        int k = i > r ? 0 : min(d2[l + r - i + 1], r - i + 1);
+        while (i - k - 1 >= 0 && i + k < n && str[i - k - 1] == str[i + k]) k++;
+        d2[i] = k--;
+        if (i + k > r) {
+            l = i - k - 1;
+            r = i + k;
+        }
+    }
+    int start = 0, maxLen = 1;
+    for (int i = 0; i < n; i++) {
+        int oddStart = i - d1[i] + 1, oddLen = 2 * d1[i] - 1;
+        if (oddLen > maxLen || (oddLen == maxLen && oddStart < start)) {
+            start = oddStart;
+            maxLen = oddLen;
+        }
+        int evenStart = i - d2[i], evenLen = 2 * d2[i];
+        if (evenLen > maxLen || (evenLen == maxLen && evenStart < start)) {
+            start = evenStart;
+            maxLen = evenLen;
+        }
+    }
+    return string(str.substr(start, maxLen));
+}
+
+// ========================================
+// BASELINE (copies of advanced_problems.cpp / core_problems.cpp)
+// ========================================
+
+string longestPalindrome(string str) {
+    if (str.length() < 1) return "";
+
+    int start = 0, maxLen = 1;
+
+    auto expandAroundCenter = [&](int left, int right) {
+        while (left >= 0 && right < (int)str.length() && str[left] == str[right]) {
+            if (right - left + 1 > maxLen) {
+                start = left;
+                maxLen = right - left + 1;
+            }
+            left--;
+            right++;
+        }
+    };
+
+    for (int i = 0; i < (int)str.length(); i++) {
+        expandAroundCenter(i, i);
+        expandAroundCenter(i, i + 1);
+    }
+
+    return str.substr(start, maxLen);
+}
+
+// countSubstring, but overlapping (advance by 1) to match count()
+int countSubstringOverlapping(const string& str, const string& substr) {
+    int count = 0;
+    size_t pos = 0;
+
+    while ((pos = str.find(substr, pos)) != string::npos) {
+        count++;
+        pos += 1;
+    }
+    return count;
+}
+
+// ========================================
+// BENCHMARK
+// ========================================
+// Usage: benchmarkSuffixIndex(bytes, queries)
+// Example: benchmarkSuffixIndex(1 << 24, 100000) - 16 MB corpus
+void benchmarkSuffixIndex(size_t bytes, size_t queries) {
+    using Clock = chrono::steady_clock;
+    auto seconds = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // Word-like corpus over a small vocabulary
+    mt19937 rng(21);
+    const char* words[] = {"index", "suffix", "array", "query", "corpus", "text", "the", "of",
+                           "banana", "search", "pattern", "rank", "a", "an", "in", "level"};
+    string corpus;
+    while (corpus.size() < bytes) {
+        corpus += words[rng() % 16];
+        corpus += ' ';
+    }
+    corpus.resize(bytes);
+
+    auto start = Clock::now();
+    SuffixIndex index(corpus);
+    double buildSecs = seconds(start);
+    cout << "build (SA-IS + LCP): " << buildSecs << " s, " << bytes / buildSecs / 1e6 << " MB/s" << endl;
+
+    // Patterns cut from the corpus
+    vector<string> patterns;
+    for (size_t i = 0; i < queries; i++) {
+        size_t len = 4 + rng() % 12;
+        patterns.push_back(corpus.substr(rng() % (bytes - len), len));
+    }
+    start = Clock::now();
+    size_t total = 0;
+    for (const string& p : patterns) total += index.count(p);
+    double indexSecs = seconds(start);
+    size_t scanQueries = min<size_t>(queries, 20);
+    start = Clock::now();
+    size_t scanTotal = 0, indexFirst = 0;
+    for (size_t i = 0; i < scanQueries; i++) {
+        scanTotal += countSubstringOverlapping(corpus, patterns[i]);
+        indexFirst += index.count(patterns[i]);
+    }
+    double scanSecs = seconds(start);
+    cout << "count queries/sec: index " << queries / indexSecs << ", linear scan " << scanQueries / scanSecs
+         << (scanTotal == indexFirst ? "" : "  MISMATCH") << " (" << total << " matches)" << endl;
+
+    start = Clock::now();
+    string_view repeated = index.longestRepeated();
+    cout << "longest repeated: " << repeated.size() << " chars in " << seconds(start) * 1e3 << " ms" << endl;
+
+    // Save, then map it back
+    string path = "/tmp/suffix_index_benchmark.idx";
+    start = Clock::now();
+    bool saved = index.save(path);
+    double saveSecs = seconds(start);
+    SuffixIndex loaded;
+    start = Clock::now();
+    bool opened = loaded.open(path);
+    double openSecs = seconds(start);
+    cout << "save " << (saved ? "ok" : "FAILED") << " " << saveSecs * 1e3 << " ms, open "
+         << (opened ? "ok" : "FAILED") << " " << openSecs * 1e3 << " ms (mapped: " << loaded.isMapped() << ")" << endl;
+    if (opened) {
+        start = Clock::now();
+        size_t loadedTotal = 0;
+        for (const string& p : patterns) loadedTotal += loaded.count(p);
+        cout << "count queries/sec on mapped index (cold pages): " << queries / seconds(start)
+             << (loadedTotal == total ? "" : "  MISMATCH") << endl;
+    }
+    remove(path.c_str());
+
+    // Palindromes: random text, then the expand-around-center worst case
+    string randomText(bytes / 16, 'a');
+    for (char& c : randomText) c = (char)('a' + rng() % 4);
+    string flat(20000, 'a');
+    for (const string* t : {&randomText, &flat}) {
+        start = Clock::now();
+        string expected = longestPalindrome(*t);
+        double expandSecs = seconds(start);
+        start = Clock::now();
+        string got = longestPalindromeManacher(*t);
+        double manacherSecs = seconds(start);
+        cout << "palindrome n=" << t->size() << ": expand " << expandSecs * 1e3 << " ms, Manacher "
+             << manacherSecs * 1e3 << " ms" << (got == expected ? "" : "  MISMATCH") << endl;
+    }
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Suffix Array Index ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // 1-3. Build and query
+    // SuffixIndex index(str);
+    // cout << "Occurrences of \"an\": " << index.count("an") << endl;
+    // for (size_t pos : index.locate("an")) cout << pos << " ";
+    // cout << endl;
+    // cout << "Longest repeated substring: " << index.longestRepeated() << endl;
+
+    // Save once, open instantly later
+    // index.save("corpus.idx");
+    // SuffixIndex loaded;
+    // if (loaded.open("corpus.idx")) cout << "Loaded " << loaded.size() << " bytes" << endl;
+
+    // 4. Longest common substring
+    // cout << "Longest common substring: " << longestCommonSubstring(str, "banana") << endl;
+
+    // 5. Longest palindrome in O(n)
+    // cout << "Longest palindrome: " << longestPalindromeManacher(str) << endl;
+
+    // Build / query / load times
+    // benchmarkSuffixIndex(1 << 24, 100000);
+
+    return 0;
+}
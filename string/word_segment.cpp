@@ -0,0 +1,551 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_set>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+using namespace std;
+
+// Build: g++ -std=c++17 -O2 -pthread word_segment.cpp
+
+// ========================================
+// WORD SEGMENTATION ENGINE
+// ========================================
+// Concept: wordBreak (advanced_problems.cpp) builds an unordered_set on
+// every call and hashes a freshly allocated substr for each of the
+// O(n^2) (start, end) pairs; the trie version (tree/trie.cpp) copies the
+// string on every recursive call. Here the dictionary is compiled once
+// into a double-array trie:
+// - Each state is one 8-byte unit {base, check}; the child of state s on
+//   byte c is t = base(s) + c + 1, valid when check[t] == s. A lookup
+//   step is one add, one load and one compare; no pointers, no per-node
+//   allocation, and the whole trie is a single contiguous array
+// - From every reachable start position the trie is walked forward one
+//   byte at a time, so each position costs at most L steps (L = longest
+//   word) and every dictionary word starting there is found in that one
+//   walk: O(n*L) for the whole string
+// - All segmentations are enumerated lazily with an explicit stack. A
+//   backward pass first marks which suffixes can be segmented at all, so
+//   the search never enters a dead end and each result costs only its
+//   own length
+// - Many inputs against one dictionary are split across threads; the
+//   trie is read-only and each thread has its own scratch buffers
+// Words are returned as string_views into the input (no copies).
+
+// ========================================
+// 1. DOUBLE-ARRAY TRIE
+// ========================================
+// Usage: DoubleArrayTrie trie(words); trie.contains("code")
+// Example: DoubleArrayTrie({"leet", "code"}).contains("leet") returns true
+class DoubleArrayTrie {
+public:
+    static constexpr int32_t ROOT = 0;
+
+    explicit DoubleArrayTrie(vector<string> words) {
+        sort(words.begin(), words.end());
+        words.erase(unique(words.begin(), words.end()), words.end());
+        if (!words.empty() && words[0].empty()) words.erase(words.begin());  // no empty word
+
+        // Free slots form a doubly linked list while building, so finding a
+        // base only looks at empty slots
+        vector<int32_t> freeNext, freePrev;
+        int32_t freeHead = -1, freeTail = -1;
+        auto grow = [&](size_t size) {
+            size_t old = units.size();
+            units.resize(size, Unit());
+            freeNext.resize(size);
+            freePrev.resize(size);
+            for (size_t i = max<size_t>(old, 1); i < size; i++) {
+                freePrev[i] = freeTail;
+                freeNext[i] = -1;
+                if (freeTail >= 0) freeNext[freeTail] = (int32_t)i;
+                else freeHead = (int32_t)i;
+                freeTail = (int32_t)i;
+            }
+        };
+        auto take = [&](int32_t i) {
+            int32_t p = freePrev[i], n = freeNext[i];
+            if (p >= 0) freeNext[p] = n;
+            else freeHead = n;
+            if (n >= 0) freePrev[n] = p;
+            else freeTail = p;
+        };
+        grow(512);
+        units[ROOT].check = ROOT;
+        struct Pending {
+            int32_t state;
+            size_t lo, hi, depth;  // words[lo, hi) share a prefix of length depth
+        };
+        vector<Pending> queue = {{ROOT, 0, words.size(), 0}};
+        vector<int> codes;
+        for (size_t q = 0; q < queue.size(); q++) {
+            Pending node = queue[q];
+            size_t lo = node.lo;
+            if (lo < node.hi && words[lo].size() == node.depth) {
+                units[node.state].base |= 1;  // a word ends here (sorted: it comes first)
+                lo++;
+            }
+            if (lo == node.hi) continue;
+
+            codes.clear();
+            for (size_t i = lo; i < node.hi; i++) {
+                int code = (unsigned char)words[i][node.depth] + 1;
+                if (codes.empty() || codes.back() != code) codes.push_back(code);
+            }
+
+            // First free slot that can hold the lowest child with all the
+            // other children landing on free slots too
+            int32_t base = 0;
+            for (int32_t f = freeHead;;) {
+                if (f < 0) {
+                    f = (int32_t)units.size();
+                    grow(units.size() * 2);
+                    continue;
+                }
+                base = f - codes[0];
+                if (base >= 1) {
+                    if ((size_t)base + 257 > units.size()) grow(units.size() * 2);
+                    bool fits = true;
+                    for (size_t k = 1; k < codes.size() && fits; k++) fits = units[base + codes[k]].check == FREE;
+                    if (fits) break;
+                }
+                f = freeNext[f];
+            }
+            units[node.state].base |= base << 1;
+            for (int code : codes) {
+                units[base + code].check = node.state;
+                take(base + code);
+            }
+
+            // Children in code order; each takes the words with that byte
+            size_t i = lo;
+            for (int code : codes) {
+                size_t j = i;
+                while (j < node.hi && (unsigned char)words[j][node.depth] + 1 == code) j++;
+                queue.push_back({base + code, i, j, node.depth + 1});
+                i = j;
+            }
+            maxDepth = max(maxDepth, node.depth + 1);
+        }
+        wordCount = words.size();
+
+        // Trim, leaving 257 slots past the highest base so a step never
+        // needs a bounds check
+        size_t used = 1;
+        for (size_t s = 0; s < units.size(); s++) {
+            if (units[s].check != FREE) used = max(used, s + 1);
+            if (units[s].check != FREE || s == ROOT) used = max(used, (size_t)(units[s].base >> 1) + 257);
+        }
+        units.resize(used, Unit());
+        units.shrink_to_fit();
+    }
+
+    // Child of state on byte c, or -1
+    int32_t step(int32_t state, unsigned char c) const {
+        int32_t t = (units[state].base >> 1) + c + 1;
+        return units[t].check == state ? t : -1;
+    }
+
+    bool isWord(int32_t state) const { return units[state].base & 1; }
+
+    bool contains(string_view word) const {
+        int32_t s = ROOT;
+        for (unsigned char c : word) {
+            if ((s = step(s, c)) < 0) return false;
+        }
+        return !word.empty() && isWord(s);
+    }
+
+    size_t size() const { return wordCount; }
+    size_t longestWord() const { return maxDepth; }
+    size_t memoryBytes() const { return units.size() * sizeof(Unit); }
+
+private:
+    static constexpr int32_t FREE = -1;
+    struct Unit {
+        int32_t base = 0;     // (child offset << 1) | word-ends-here
+        int32_t check = FREE; // parent state
+    };
+    vector<Unit> units;
+    size_t wordCount = 0;
+    size_t maxDepth = 0;
+};
+
+// ========================================
+// 2. SEGMENTER (O(n*L) DP)
+// ========================================
+// Usage: WordSegmenter seg(words);
+//        seg.canSegment(str); seg.segment(str, out);
+// Example: WordSegmenter({"leet", "code"}).segment("leetcode", out)
+//          gives out = {"leet", "code"}
+// segment() picks a segmentation with the fewest words. The Scratch
+// overloads reuse buffers between calls (one Scratch per thread).
+class WordSegmenter {
+public:
+    struct Scratch {
+        vector<int32_t> cost;  // fewest words for s[0, i), INT_MAX if none
+        vector<int32_t> from;  // start of the last word in that segmentation
+        vector<uint8_t> flag;
+    };
+
+    explicit WordSegmenter(vector<string> words) : trie(move(words)) {}
+
+    const DoubleArrayTrie& dictionary() const { return trie; }
+
+    bool canSegment(string_view s, Scratch& scratch) const {
+        size_t n = s.size();
+        vector<uint8_t>& reach = scratch.flag;
+        reach.assign(n + 1, 0);
+        reach[0] = 1;
+        for (size_t i = 0; i < n; i++) {
+            if (!reach[i]) continue;
+            int32_t state = DoubleArrayTrie::ROOT;
+            for (size_t j = i; j < n; j++) {
+                if ((state = trie.step(state, s[j])) < 0) break;
+                if (trie.isWord(state)) reach[j + 1] = 1;
+            }
+            if (reach[n]) return true;
+        }
+        return reach[n];
+    }
+
+    bool canSegment(string_view s) const {
+        Scratch scratch;
+        return canSegment(s, scratch);
+    }
+
+    // Fewest-words segmentation; false (and out empty) if there is none
+    bool segment(string_view s, vector<string_view>& out, Scratch& scratch) const {
+        out.clear();
+        size_t n = s.size();
+        vector<int32_t>& cost = scratch.cost;
+        vector<int32_t>& from = scratch.from;
+        cost.assign(n + 1, INT_MAX);
+        from.resize(n + 1);
+        cost[0] = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (cost[i] == INT_MAX) continue;
+            int32_t state = DoubleArrayTrie::ROOT;
+            for (size_t j = i; j < n; j++) {
+                if ((state = trie.step(state, s[j])) < 0) break;
+                if (trie.isWord(state) && cost[i] + 1 < cost[j + 1]) {
+                    cost[j + 1] = cost[i] + 1;
+                    from[j + 1] = (int32_t)i;
+                }
+            }
+        }
+        if (cost[n] == INT_MAX) return false;
+        out.resize(cost[n]);
+        for (size_t end = n, k = out.size(); k-- > 0; end = from[end]) {
+            out[k] = s.substr(from[end], end - from[end]);
+        }
+        return true;
+    }
+
+    bool segment(string_view s, vector<string_view>& out) const {
+        Scratch scratch;
+        return segment(s, out, scratch);
+    }
+
+    // Marks canFinish[i] = s[i, n) can be segmented (canFinish[n] = 1)
+    void suffixSegmentable(string_view s, vector<uint8_t>& canFinish) const {
+        size_t n = s.size();
+        canFinish.assign(n + 1, 0);
+        canFinish[n] = 1;
+        for (size_t i = n; i-- > 0;) {
+            int32_t state = DoubleArrayTrie::ROOT;
+            for (size_t j = i; j < n; j++) {
+                if ((state = trie.step(state, s[j])) < 0) break;
+                if (trie.isWord(state) && canFinish[j + 1]) {
+                    canFinish[i] = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    DoubleArrayTrie trie;
+};
+
+// ========================================
+// 3. ALL SEGMENTATIONS (LAZY)
+// ========================================
+// Usage: SegmentationEnumerator it(seg, str);
+//        while (it.next(words)) { ... }
+// Example: for "catsanddog" with {"cat", "cats", "and", "sand", "dog"}
+//          yields {"cat", "sand", "dog"} then {"cats", "and", "dog"}
+// Results come in lexicographic order of word lengths, shortest first
+// word first. The count can be exponential in n; take only what you need.
+class SegmentationEnumerator {
+public:
+    SegmentationEnumerator(const WordSegmenter& segmenter, string_view text)
+        : trie(segmenter.dictionary()), s(text) {
+        segmenter.suffixSegmentable(s, canFinish);
+        if (canFinish[0]) stack.push_back({0, 0, DoubleArrayTrie::ROOT});
+    }
+
+    bool next(vector<string_view>& words) {
+        size_t n = s.size();
+        if (n == 0) {
+            // The empty string has exactly one (empty) segmentation
+            words.clear();
+            bool first = !stack.empty();
+            stack.clear();
+            return first;
+        }
+        while (!stack.empty()) {
+            Frame& f = stack.back();
+            bool found = false;
+            while (f.end < n) {
+                if ((f.state = trie.step(f.state, s[f.end])) < 0) break;
+                f.end++;
+                if (trie.isWord(f.state) && canFinish[f.end]) {
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                stack.pop_back();
+                continue;
+            }
+            if (f.end == n) {
+                words.clear();
+                for (const Frame& w : stack) words.push_back(s.substr(w.start, w.end - w.start));
+                return true;
+            }
+            uint32_t start = f.end;
+            stack.push_back({start, start, DoubleArrayTrie::ROOT});
+        }
+        return false;
+    }
+
+private:
+    struct Frame {
+        uint32_t start;  // word start
+        uint32_t end;    // bytes consumed so far: the word is s[start, end)
+        int32_t state;   // trie state after s[start, end)
+    };
+    const DoubleArrayTrie& trie;
+    string_view s;
+    vector<uint8_t> canFinish;
+    vector<Frame> stack;
+};
+
+// ========================================
+// 4. BATCH SEGMENTATION (THREADS)
+// ========================================
+// Usage: segmentBatch(seg, inputs, out [, threads])
+// out[i] is the fewest-words segmentation of inputs[i] (views into
+// inputs[i]), empty if it has none. Threads take blocks of inputs from a
+// shared counter so uneven lengths balance out; threads = 0 uses all cores.
+void segmentBatch(const WordSegmenter& segmenter, const vector<string>& inputs,
+                  vector<vector<string_view>>& out, size_t threads = 0) {
+    const size_t BLOCK = 64;
+    out.resize(inputs.size());
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    threads = max<size_t>(1, min(threads, (inputs.size() + BLOCK - 1) / BLOCK));
+
+    atomic<size_t> nextBlock(0);
+    auto work = [&] {
+        WordSegmenter::Scratch scratch;
+        for (;;) {
+            size_t lo = nextBlock.fetch_add(BLOCK);
+            if (lo >= inputs.size()) return;
+            size_t hi = min(inputs.size(), lo + BLOCK);
+            for (size_t i = lo; i < hi; i++) segmenter.segment(inputs[i], out[i], scratch);
+        }
+    };
+    vector<thread> workers;
+    for (size_t t = 1; t < threads; t++) workers.emplace_back(work);
+    work();
+    for (auto& w : workers) w.join();
+}
+
+// ========================================
+// BASELINE (copy of advanced_problems.cpp, without printing)
+// ========================================
+
+bool wordBreak(string str, string dict[], int dictSize) {
+    unordered_set<string> wordDict(dict, dict + dictSize);
+    int n = str.length();
+    vector<bool> dp(n + 1, false);
+    dp[0] = true;
+
+    for (int i = 1; i <= n; i++) {
+        for (int j = 0; j < i; j++) {
+            if (dp[j] && wordDict.find(str.substr(j, i - j)) != wordDict.end()) {
+                dp[i] = true;
+                break;
+            }
+        }
+    }
+
+    return dp[n];
+}
+
+// ========================================
+// BENCHMARK
+// ========================================
+// Usage: benchmarkWordSegment(dictWords, inputs, inputBytes)
+// Example: benchmarkWordSegment(50000, 100000, 64)
+// Inputs are concatenations of dictionary words (so most are segmentable)
+// with an occasional corrupted byte.
+void benchmarkWordSegment(size_t dictWords, size_t inputCount, size_t inputBytes) {
+    using Clock = chrono::steady_clock;
+    auto seconds = [](Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    mt19937 rng(24);
+    vector<string> dict;
+    for (size_t i = 0; i < dictWords; i++) {
+        string w;
+        size_t len = 2 + rng() % 9;
+        for (size_t k = 0; k < len; k++) w += (char)('a' + (rng() % 26 < 20 ? rng() % 8 : rng() % 26));
+        dict.push_back(w);
+    }
+    vector<string> inputs;
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < inputCount; i++) {
+        string s;
+        while (s.size() < inputBytes) s += dict[rng() % dict.size()];
+        if (rng() % 10 == 0) s[rng() % s.size()] = 'z';
+        totalBytes += s.size();
+        inputs.push_back(s);
+    }
+
+    auto start = Clock::now();
+    WordSegmenter seg(dict);
+    double buildMs = seconds(start) * 1000;
+
+    // Baseline rebuilds its set per call, as written; time a slice
+    size_t baseCount = min<size_t>(inputCount, 50);
+    start = Clock::now();
+    size_t baseOk = 0;
+    for (size_t i = 0; i < baseCount; i++) baseOk += wordBreak(inputs[i], dict.data(), (int)dict.size());
+    double baseRate = baseCount / seconds(start);
+
+    // Same DP with the set hoisted out, to separate the two costs
+    unordered_set<string> set(dict.begin(), dict.end());
+    start = Clock::now();
+    size_t hoistOk = 0;
+    for (const string& str : inputs) {
+        int n = str.length();
+        vector<bool> dp(n + 1, false);
+        dp[0] = true;
+        for (int i = 1; i <= n; i++) {
+            for (int j = 0; j < i; j++) {
+                if (dp[j] && set.count(str.substr(j, i - j))) {
+                    dp[i] = true;
+                    break;
+                }
+            }
+        }
+        hoistOk += dp[n];
+    }
+    double hoistRate = inputCount / seconds(start);
+
+    WordSegmenter::Scratch scratch;
+    start = Clock::now();
+    size_t ok = 0, sliceOk = 0;
+    for (size_t i = 0; i < inputCount; i++) {
+        bool r = seg.canSegment(inputs[i], scratch);
+        ok += r;
+        if (i < baseCount) sliceOk += r;
+    }
+    double canRate = inputCount / seconds(start);
+
+    vector<string_view> words;
+    start = Clock::now();
+    size_t segOk = 0;
+    for (const string& s : inputs) segOk += seg.segment(s, words, scratch);
+    double segRate = inputCount / seconds(start);
+
+    vector<vector<string_view>> out;
+    size_t threads = max(1u, thread::hardware_concurrency());
+    start = Clock::now();
+    segmentBatch(seg, inputs, out, threads);
+    double batchRate = inputCount / seconds(start);
+
+    // Worst case for enumeration: every split of "aaa..." is valid
+    WordSegmenter as({"a", "aa", "aaa"});
+    string aaa(30, 'a');
+    SegmentationEnumerator it(as, aaa);
+    start = Clock::now();
+    size_t listed = 0;
+    while (listed < 1000000 && it.next(words)) listed++;
+    double enumRate = listed / seconds(start);
+
+    double mb = totalBytes / (double)inputCount / 1e6;
+    cout << dict.size() << " words, trie " << seg.dictionary().memoryBytes() / 1024 << " KB, built in "
+         << buildMs << " ms" << endl;
+    cout << inputCount << " inputs of ~" << inputBytes << " bytes, " << ok << " segmentable" << endl;
+    cout << "wordBreak (set per call):  " << baseRate << " inputs/sec"
+         << (baseOk == sliceOk ? "" : "  MISMATCH") << endl;
+    cout << "wordBreak (set hoisted):   " << hoistRate << " inputs/sec, " << hoistRate * mb << " MB/s"
+         << (hoistOk == ok ? "" : "  MISMATCH") << endl;
+    cout << "canSegment:                " << canRate << " inputs/sec, " << canRate * mb << " MB/s" << endl;
+    cout << "segment (fewest words):    " << segRate << " inputs/sec, " << segRate * mb << " MB/s"
+         << (segOk == ok ? "" : "  MISMATCH") << endl;
+    cout << "segmentBatch (" << threads << " threads):  " << batchRate << " inputs/sec, " << batchRate * mb
+         << " MB/s" << endl;
+    cout << "enumerate \"a\" x 30:        " << enumRate << " segmentations/sec" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Word Segmentation ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // WordSegmenter seg({"cat", "cats", "and", "sand", "dog", "leet", "code"});
+
+    // 1. Can the string be split into dictionary words?
+    // if (seg.canSegment(str)) {
+    //     cout << "Can be segmented." << endl;
+    // } else {
+    //     cout << "Cannot be segmented." << endl;
+    // }
+
+    // 2. One segmentation (fewest words)
+    // vector<string_view> words;
+    // if (seg.segment(str, words)) {
+    //     for (string_view w : words) cout << w << " ";
+    //     cout << endl;
+    // }
+
+    // 3. Every segmentation, one at a time
+    // SegmentationEnumerator it(seg, str);
+    // while (it.next(words)) {
+    //     for (string_view w : words) cout << w << " ";
+    //     cout << endl;
+    // }
+
+    // 4. Many inputs on all cores
+    // vector<string> inputs = {"catsanddog", "leetcode", "catdog"};
+    // vector<vector<string_view>> results;
+    // segmentBatch(seg, inputs, results);
+
+    // Throughput vs the unordered_set DP
+    // benchmarkWordSegment(50000, 100000, 64);
+
+    return 0;
+}
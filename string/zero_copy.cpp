@@ -0,0 +1,478 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+using namespace std;
+
+// ========================================
+// ZERO-COPY STRING OPERATIONS
+// ========================================
+// Concept: Every function in basic_operations.cpp takes std::string by
+// value and returns a new std::string, so each call copies its input and
+// (past the 15-char small-string buffer) allocates twice. The API below
+// does the same operations without copies:
+// - Readers take string_view (no copy, works on literals / substrings)
+// - In-place mutators change a string& or a raw char buffer
+// - ...Into variants write into a caller-owned output string, reusing its
+//   capacity, so a loop that reuses `out` stops allocating after warm-up
+// - StringBuilder replaces repeated `s = s + piece` (O(n^2) copying)
+// Nothing here prints; invalid positions are reported by the return value.
+// Case conversion is ASCII, like ::toupper / ::tolower in the "C" locale.
+
+// ========================================
+// ALLOCATION COUNTER (for the benchmark)
+// ========================================
+// Replaces global operator new / delete for this program only.
+size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// ========================================
+// 1. READ-ONLY VIEWS
+// ========================================
+
+// Usage: len = getLengthView(str)
+size_t getLengthView(string_view str) {
+    return str.size();
+}
+
+// Usage: sub = getSubstringView(str, start, length) - a view into str
+// Example: getSubstringView("Hello", 1, 3) returns "ell"; invalid start
+// returns an empty view. The view is valid as long as str's buffer is.
+string_view getSubstringView(string_view str, size_t start, size_t length) {
+    if (start >= str.size()) return string_view();
+    return str.substr(start, length);
+}
+
+// Usage: cmp = compareStringsView(str1, str2) - 0, <0 or >0
+int compareStringsView(string_view str1, string_view str2) {
+    return str1.compare(str2);
+}
+
+// ========================================
+// 2. IN-PLACE MUTATORS
+// ========================================
+// Raw-buffer versions work on any char array; the string& versions only
+// allocate if an insert exceeds str.capacity().
+
+inline char asciiUpper(char c) { return (c >= 'a' && c <= 'z') ? (char)(c - 32) : c; }
+inline char asciiLower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c + 32) : c; }
+
+// Usage: insertCharInPlace(str, pos, ch) - false if pos > length
+// Example: "Helo", 3, 'l' becomes "Hello"
+bool insertCharInPlace(string& str, size_t pos, char ch) {
+    if (pos > str.size()) return false;
+    str.insert(str.begin() + pos, ch);
+    return true;
+}
+
+// Usage: deleteCharInPlace(str, pos) - false if pos >= length
+// Example: "Hello", 1 becomes "Hllo"
+bool deleteCharInPlace(string& str, size_t pos) {
+    if (pos >= str.size()) return false;
+    str.erase(str.begin() + pos);
+    return true;
+}
+
+// Usage: count = replaceCharInPlace(data, n, oldChar, newChar)
+// Example: "Hello", 'l', 'x' becomes "Hexxo" and returns 2
+size_t replaceCharInPlace(char* data, size_t n, char oldChar, char newChar) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        bool hit = data[i] == oldChar;
+        count += hit;
+        data[i] = hit ? newChar : data[i];
+    }
+    return count;
+}
+size_t replaceCharInPlace(string& str, char oldChar, char newChar) {
+    return replaceCharInPlace(&str[0], str.size(), oldChar, newChar);
+}
+
+// Usage: toUpperInPlace(str) / toLowerInPlace(str)
+void toUpperInPlace(char* data, size_t n) {
+    for (size_t i = 0; i < n; i++) data[i] = asciiUpper(data[i]);
+}
+void toUpperInPlace(string& str) { toUpperInPlace(&str[0], str.size()); }
+
+void toLowerInPlace(char* data, size_t n) {
+    for (size_t i = 0; i < n; i++) data[i] = asciiLower(data[i]);
+}
+void toLowerInPlace(string& str) { toLowerInPlace(&str[0], str.size()); }
+
+// Usage: reverseInPlace(str)
+void reverseInPlace(char* data, size_t n) { reverse(data, data + n); }
+void reverseInPlace(string& str) { reverseInPlace(&str[0], str.size()); }
+
+// ========================================
+// 3. OUTPUT-BUFFER VARIANTS
+// ========================================
+// Each overwrites `out` and keeps its capacity. The inputs must not be
+// views into `out` itself.
+
+// Usage: concatenateInto(str1, str2, out)
+// Example: concatenateInto("Hello", "World", out) - out is "HelloWorld"
+void concatenateInto(string_view str1, string_view str2, string& out) {
+    out.resize(str1.size() + str2.size());
+    memcpy(&out[0], str1.data(), str1.size());
+    memcpy(&out[0] + str1.size(), str2.data(), str2.size());
+}
+
+// Usage: getSubstringInto(str, start, length, out) - false if start is invalid
+bool getSubstringInto(string_view str, size_t start, size_t length, string& out) {
+    if (start >= str.size()) {
+        out.clear();
+        return false;
+    }
+    out.assign(str.substr(start, length));
+    return true;
+}
+
+// Usage: insertCharInto(str, pos, ch, out) - false if pos > length
+bool insertCharInto(string_view str, size_t pos, char ch, string& out) {
+    if (pos > str.size()) return false;
+    out.resize(str.size() + 1);
+    memcpy(&out[0], str.data(), pos);
+    out[pos] = ch;
+    memcpy(&out[0] + pos + 1, str.data() + pos, str.size() - pos);
+    return true;
+}
+
+// Usage: deleteCharInto(str, pos, out) - false if pos >= length
+bool deleteCharInto(string_view str, size_t pos, string& out) {
+    if (pos >= str.size()) return false;
+    out.resize(str.size() - 1);
+    memcpy(&out[0], str.data(), pos);
+    memcpy(&out[0] + pos, str.data() + pos + 1, str.size() - pos - 1);
+    return true;
+}
+
+// Usage: count = replaceCharInto(str, oldChar, newChar, out)
+size_t replaceCharInto(string_view str, char oldChar, char newChar, string& out) {
+    out.assign(str);
+    return replaceCharInPlace(out, oldChar, newChar);
+}
+
+// Usage: toUpperInto(str, out) / toLowerInto(str, out)
+void toUpperInto(string_view str, string& out) {
+    out.resize(str.size());
+    for (size_t i = 0; i < str.size(); i++) out[i] = asciiUpper(str[i]);
+}
+void toLowerInto(string_view str, string& out) {
+    out.resize(str.size());
+    for (size_t i = 0; i < str.size(); i++) out[i] = asciiLower(str[i]);
+}
+
+// Usage: reverseInto(str, out)
+void reverseInto(string_view str, string& out) {
+    out.assign(str.rbegin(), str.rend());
+}
+
+// ========================================
+// 4. STRING BUILDER
+// ========================================
+// Concept: Appends go into chunks that are never moved, so n appends copy
+// each byte once (repeated `s = s + piece` recopies the whole prefix).
+// - The first 128 bytes live inside the object (small-buffer), so short
+//   builds never allocate
+// - Chunks double in size; clear() keeps them for the next build, so a
+//   reused builder reaches zero allocations per build
+// - build() makes one exact-size string; buildInto() reuses a string
+// Usage: StringBuilder sb; sb.append("a").append(x); string s = sb.build();
+class StringBuilder {
+    static const size_t INLINE_CAP = 128;
+
+    struct Chunk {
+        unique_ptr<char[]> data;
+        size_t used;
+        size_t cap;
+    };
+
+    char inlineBuf[INLINE_CAP];
+    size_t inlineUsed;
+    vector<Chunk> chunks;  // heap chunks after the inline one
+    size_t active;         // chunks[0 .. active) are in use this build
+    size_t total;
+
+    // Room for at least one more byte; returns the chunk to write into
+    Chunk& chunkWithRoom(size_t want) {
+        if (active > 0 && chunks[active - 1].used < chunks[active - 1].cap) return chunks[active - 1];
+        if (active < chunks.size()) {
+            // Reuse a chunk kept by clear()
+            chunks[active].used = 0;
+            return chunks[active++];
+        }
+        size_t prevCap = chunks.empty() ? INLINE_CAP : chunks.back().cap;
+        size_t cap = max(prevCap * 2, want);
+        chunks.push_back({unique_ptr<char[]>(new char[cap]), 0, cap});
+        active++;
+        return chunks.back();
+    }
+
+public:
+    StringBuilder() : inlineUsed(0), active(0), total(0) {}
+
+    StringBuilder(const StringBuilder&) = delete;
+    StringBuilder& operator=(const StringBuilder&) = delete;
+
+    size_t size() const { return total; }
+    bool isEmpty() const { return total == 0; }
+
+    StringBuilder& append(string_view piece) {
+        total += piece.size();
+        const char* src = piece.data();
+        size_t left = piece.size();
+
+        if (active == 0) {
+            size_t n = min(left, INLINE_CAP - inlineUsed);
+            memcpy(inlineBuf + inlineUsed, src, n);
+            inlineUsed += n;
+            src += n;
+            left -= n;
+        }
+        while (left > 0) {
+            Chunk& c = chunkWithRoom(left);
+            size_t n = min(left, c.cap - c.used);
+            memcpy(c.data.get() + c.used, src, n);
+            c.used += n;
+            src += n;
+            left -= n;
+        }
+        return *this;
+    }
+
+    StringBuilder& append(char ch) { return append(string_view(&ch, 1)); }
+
+    // Calls fn(string_view) for each stored piece, in order (zero-copy output)
+    template <typename Fn>
+    void forEachPiece(Fn fn) const {
+        if (inlineUsed) fn(string_view(inlineBuf, inlineUsed));
+        for (size_t i = 0; i < active; i++) {
+            if (chunks[i].used) fn(string_view(chunks[i].data.get(), chunks[i].used));
+        }
+    }
+
+    // Copies the contents to out (room for size() chars)
+    void writeTo(char* out) const {
+        forEachPiece([&](string_view p) {
+            memcpy(out, p.data(), p.size());
+            out += p.size();
+        });
+    }
+
+    void buildInto(string& out) const {
+        out.resize(total);
+        writeTo(&out[0]);
+    }
+
+    string build() const {
+        string out;
+        buildInto(out);
+        return out;
+    }
+
+    // Empties the builder but keeps its chunks for reuse
+    void clear() {
+        inlineUsed = 0;
+        active = 0;
+        total = 0;
+    }
+};
+
+ostream& operator<<(ostream& os, const StringBuilder& sb) {
+    sb.forEachPiece([&](string_view p) { os.write(p.data(), p.size()); });
+    return os;
+}
+
+// ========================================
+// BASELINE (copies of basic_operations.cpp, without printing)
+// ========================================
+
+string concatenate(string str1, string str2) {
+    return str1 + str2;
+}
+
+string getSubstring(string str, int start, int length) {
+    if (start < 0 || start >= (int)str.length()) {
+        return "";
+    }
+    return str.substr(start, length);
+}
+
+string insertChar(string str, int pos, char ch) {
+    if (pos < 0 || pos > (int)str.length()) {
+        return str;
+    }
+    str.insert(pos, 1, ch);
+    return str;
+}
+
+string deleteChar(string str, int pos) {
+    if (pos < 0 || pos >= (int)str.length()) {
+        return str;
+    }
+    str.erase(pos, 1);
+    return str;
+}
+
+string replaceChar(string str, char oldChar, char newChar) {
+    for (int i = 0; i < (int)str.length(); i++) {
+        if (str[i] == oldChar) {
+            str[i] = newChar;
+        }
+    }
+    return str;
+}
+
+string toUpperCase(string str) {
+    transform(str.begin(), str.end(), str.begin(), ::toupper);
+    return str;
+}
+
+string reverseString(string str) {
+    reverse(str.begin(), str.end());
+    return str;
+}
+
+// ========================================
+// BENCHMARK: ALLOCATIONS AND TIME PER CALL
+// ========================================
+// Usage: benchmarkZeroCopy(iterations)
+// Example: benchmarkZeroCopy(1000000) - 64-char strings (past the SSO buffer)
+void benchmarkZeroCopy(int iterations) {
+    using Clock = chrono::steady_clock;
+    const string text = "The quick brown fox jumps over the lazy dog, again and again!!!";
+    const string other = "Pack my box with five dozen liquor jugs; how vexingly quick!!!!";
+    size_t checksum = 0;
+
+    cout << "operation           by-value: allocs/call  ns/call    zero-copy: allocs/call  ns/call" << endl;
+    auto run = [&](const char* name, auto&& baseline, auto&& fast) {
+        size_t a0 = allocationCount;
+        auto t0 = Clock::now();
+        for (int i = 0; i < iterations; i++) checksum += baseline(i);
+        auto t1 = Clock::now();
+        size_t a1 = allocationCount;
+        for (int i = 0; i < iterations; i++) checksum += fast(i);
+        auto t2 = Clock::now();
+        size_t a2 = allocationCount;
+        cout << name << "  " << (double)(a1 - a0) / iterations << "  "
+             << chrono::duration<double, nano>(t1 - t0).count() / iterations << "    "
+             << (double)(a2 - a1) / iterations << "  "
+             << chrono::duration<double, nano>(t2 - t1).count() / iterations << endl;
+    };
+
+    // Output buffers / working strings are set up before counting starts
+    string out, work = text;
+    out.reserve(256);
+    work.reserve(256);
+
+    run("concatenate    ", [&](int) { return concatenate(text, other).size(); },
+        [&](int) { concatenateInto(text, other, out); return out.size(); });
+    run("getSubstring   ", [&](int i) { return getSubstring(text, i % 32, 16)[0]; },
+        [&](int i) { return getSubstringView(text, i % 32, 16)[0]; });
+    run("insertChar     ", [&](int i) { return insertChar(text, i % 64, 'X').size(); },
+        [&](int i) {
+            insertCharInPlace(work, i % 64, 'X');
+            deleteCharInPlace(work, i % 64);
+            return work.size();
+        });
+    run("insertChar Into", [&](int i) { return insertChar(text, i % 64, 'X').size(); },
+        [&](int i) { insertCharInto(text, i % 64, 'X', out); return out.size(); });
+    run("deleteChar     ", [&](int i) { return deleteChar(text, i % 64).size(); },
+        [&](int i) { deleteCharInto(text, i % 64, out); return out.size(); });
+    run("replaceChar    ", [&](int) { return (size_t)replaceChar(text, 'o', '0')[12]; },
+        [&](int i) { return replaceCharInPlace(work, i & 1 ? '0' : 'o', i & 1 ? 'o' : '0'); });
+    run("toUpperCase    ", [&](int) { return (size_t)toUpperCase(text)[5]; },
+        [&](int) { toUpperInto(text, out); return (size_t)out[5]; });
+    run("reverseString  ", [&](int) { return (size_t)reverseString(text)[0]; },
+        [&](int) { reverseInPlace(work); return (size_t)work[0]; });
+
+    // Repeated concatenation: 1000 pieces per build
+    const int PIECES = 1000;
+    int builds = max(1, iterations / PIECES);
+    StringBuilder sb;
+    auto buildOnce = [&] {
+        sb.clear();
+        for (int p = 0; p < PIECES; p++) sb.append(string_view(text).substr(0, 16 + p % 32));
+        sb.buildInto(out);
+        return out.size();
+    };
+    buildOnce();  // warm-up: chunks and out are kept for the timed builds
+    size_t a0 = allocationCount;
+    auto t0 = Clock::now();
+    for (int b = 0; b < builds; b++) {
+        string s;
+        for (int p = 0; p < PIECES; p++) s = s + text.substr(0, 16 + p % 32);
+        checksum += s.size();
+    }
+    auto t1 = Clock::now();
+    size_t a1 = allocationCount;
+    for (int b = 0; b < builds; b++) checksum += buildOnce();
+    auto t2 = Clock::now();
+    size_t a2 = allocationCount;
+    cout << "s = s + piece x" << PIECES << ": " << (double)(a1 - a0) / builds << " allocs, "
+         << chrono::duration<double, micro>(t1 - t0).count() / builds << " us per build" << endl;
+    cout << "StringBuilder x" << PIECES << ":  " << (double)(a2 - a1) / builds << " allocs, "
+         << chrono::duration<double, micro>(t2 - t1).count() / builds << " us per build" << endl;
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+// ========================================
+// MAIN FUNCTION
+// ========================================
+
+int main() {
+    string str;
+
+    cout << "Enter a string: ";
+    getline(cin, str);
+
+    cout << "\n=== Zero-Copy String Operations ===" << endl;
+    cout << "String: \"" << str << "\"" << endl;
+
+    // ========================================
+    // Example function calls - uncomment to use
+    // ========================================
+
+    // Substring view (no copy)
+    // string_view sub = getSubstringView(str, 0, 3);
+    // cout << "Substring: " << sub << endl;
+
+    // In-place edits
+    // insertCharInPlace(str, 2, 'X');
+    // deleteCharInPlace(str, 1);
+    // cout << "Replaced: " << replaceCharInPlace(str, 'l', 'x') << endl;
+    // toUpperInPlace(str);
+    // reverseInPlace(str);
+    // cout << "String: \"" << str << "\"" << endl;
+
+    // Output buffer reused across calls
+    // string out;
+    // concatenateInto(str, " World", out);
+    // cout << out << endl;
+    // toLowerInto(out, str);
+    // cout << str << endl;
+
+    // Builder for repeated concatenation
+    // StringBuilder sb;
+    // for (int i = 0; i < 5; i++) sb.append("item").append(char('0' + i)).append(' ');
+    // cout << sb << endl;
+    // string built = sb.build();
+
+    // Allocations and time against the by-value API
+    // benchmarkZeroCopy(1000000);
+
+    return 0;
+}